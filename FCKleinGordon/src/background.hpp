@@ -0,0 +1,38 @@
+#ifndef FC_KLEIN_GORDON_BACKGROUND_HPP
+#define FC_KLEIN_GORDON_BACKGROUND_HPP
+
+#include <KleinGordonTensor.hpp>
+#include <cctk.h>
+#include <cmath>
+
+namespace fckg {
+
+/*
+ * Inverse spatial metric and square root of its determinant. These are the
+ * only background quantities entering the fluxes and sources, so in static
+ * background evolutions they are cached in the background group.
+ */
+struct metric_inverse {
+  tensor::sym3<CCTK_REAL> ig;
+  CCTK_REAL sqrtg;
+};
+
+inline auto invert_metric(CCTK_REAL gxx, CCTK_REAL gxy, CCTK_REAL gxz, CCTK_REAL gyy,
+                          CCTK_REAL gyz, CCTK_REAL gzz) noexcept -> metric_inverse {
+  using std::sqrt;
+
+  const tensor::sym3<CCTK_REAL> g{gxx, gxy, gxz, gyy, gyz, gzz};
+  const auto [det, ig]{tensor::det_and_inverse(g)};
+
+  return {ig, sqrt(det)};
+}
+
+inline auto sqrt_det_gamma(CCTK_REAL gxx, CCTK_REAL gxy, CCTK_REAL gxz, CCTK_REAL gyy,
+                           CCTK_REAL gyz, CCTK_REAL gzz) noexcept -> CCTK_REAL {
+  using std::sqrt;
+  return sqrt(tensor::det(tensor::sym3<CCTK_REAL>{gxx, gxy, gxz, gyy, gyz, gzz}));
+}
+
+} // namespace fckg
+
+#endif // FC_KLEIN_GORDON_BACKGROUND_HPP
@@ -0,0 +1,33 @@
+#include <cctk.h>
+#include <cctk_Arguments.h>
+#include <cctk_Parameters.h>
+
+#include "background.hpp"
+
+#ifndef DECLARE_CCTK_ARGUMENTS_CHECKED
+#  define DECLARE_CCTK_ARGUMENTS_CHECKED(func) DECLARE_CCTK_ARGUMENTS
+#endif
+
+extern "C" void FCKleinGordon_calc_background(CCTK_ARGUMENTS) {
+  using namespace fckg;
+
+  DECLARE_CCTK_ARGUMENTS_CHECKED(FCKleinGordon_calc_background);
+  DECLARE_CCTK_PARAMETERS;
+
+#pragma omp parallel
+  CCTK_LOOP3_ALL(loop_background, cctkGH, i, j, k) {
+
+    const auto ijk{CCTK_GFINDEX3D(cctkGH, i, j, k)};
+
+    const auto m{invert_metric(gxx[ijk], gxy[ijk], gxz[ijk], gyy[ijk], gyz[ijk], gzz[ijk])};
+
+    ig_xx[ijk] = m.ig.xx;
+    ig_xy[ijk] = m.ig.xy;
+    ig_xz[ijk] = m.ig.xz;
+    ig_yy[ijk] = m.ig.yy;
+    ig_yz[ijk] = m.ig.yz;
+    ig_zz[ijk] = m.ig.zz;
+    sqrt_gamma[ijk] = m.sqrtg;
+  }
+  CCTK_ENDLOOP3_ALL(loop_background);
+}
@@ -1,45 +1,123 @@
 #include <cctk.h>
 #include <cctk_Arguments.h>
+#include <cctk_Functions.h>
 #include <cctk_Parameters.h>
+
+#include "background.hpp"
+#include "energy_monitor.hpp"
+#include "fluxes.hpp"
+
+#include <KleinGordonReductions.hpp>
+
 #include <cmath>
 
 #ifndef DECLARE_CCTK_ARGUMENTS_CHECKED
 #  define DECLARE_CCTK_ARGUMENTS_CHECKED(func) DECLARE_CCTK_ARGUMENTS
 #endif
 
-extern "C" void FCKleinGordon_calc_flux(CCTK_ARGUMENTS) {
-  using std::sqrt;
+namespace {
+
+/*
+ * Computes the fluxes on every point. With monitor set, the same sweep also accumulates the
+ * conserved energy over the interior and its outgoing flux through the outermost interior
+ * layer of the physical outer boundary faces. The energy is weighted like KleinGordon's total
+ * energy, so that Llama's interpatch overlaps are counted once, and the flux by
+ * CarpetReduce::weight when it is available.
+ */
+template <bool monitor> void calc_flux(CCTK_ARGUMENTS) {
+  using namespace fckg;
 
   DECLARE_CCTK_ARGUMENTS_CHECKED(FCKleinGordon_calc_flux);
   DECLARE_CCTK_PARAMETERS;
 
-#pragma omp parallel
-  CCTK_LOOP3_INT(loop_flux, cctkGH, i, j, k) {
+  CCTK_INT bndsize[6], is_ghostbnd[6], is_symbnd[6], is_physbnd[6];
+  reduction::volume_weights vw{};
+
+  if (monitor) {
+    GetBoundarySizesAndTypes(cctkGH, 6, bndsize, is_ghostbnd, is_symbnd, is_physbnd);
+    vw = reduction::get_volume_weights(cctkGH);
+  }
+
+  const CCTK_REAL dx[3]{CCTK_DELTA_SPACE(0), CCTK_DELTA_SPACE(1), CCTK_DELTA_SPACE(2)};
+
+  CCTK_REAL energy{0.0}, flux{0.0};
+
+#pragma omp parallel reduction(+ : energy, flux)
+  CCTK_LOOP3_ALL(loop_flux, cctkGH, i, j, k) {
 
     const auto ijk{CCTK_GFINDEX3D(cctkGH, i, j, k)};
 
-    const auto det_gamma{-(gxz[ijk] * gxz[ijk] * gyy[ijk]) + 2 * gxy[ijk] * gxz[ijk] * gyz[ijk]
-                         - gxx[ijk] * gyz[ijk] * gyz[ijk] - gxy[ijk] * gxy[ijk] * gzz[ijk]
-                         + gxx[ijk] * gyy[ijk] * gzz[ijk]};
+    const auto m{static_background
+                     ? metric_inverse{{ig_xx[ijk], ig_xy[ijk], ig_xz[ijk], ig_yy[ijk], ig_yz[ijk],
+                                       ig_zz[ijk]},
+                                      sqrt_gamma[ijk]}
+                     : invert_metric(gxx[ijk], gxy[ijk], gxz[ijk], gyy[ijk], gyz[ijk], gzz[ijk])};
+
+    const jacobian J{J11[ijk], J12[ijk], J13[ijk], J21[ijk], J22[ijk],
+                     J23[ijk], J31[ijk], J32[ijk], J33[ijk]};
+
+    const auto FG{compute_fluxes(m, alp[ijk], betax[ijk], betay[ijk], betaz[ijk], Pi[ijk],
+                                 Psi_x[ijk], Psi_y[ijk], Psi_z[ijk])};
+    const auto F{densitize(J, FG)};
+
+    F_Pi_a[ijk] = F.F_Pi_a;
+    F_Pi_b[ijk] = F.F_Pi_b;
+    F_Pi_c[ijk] = F.F_Pi_c;
+
+    F_Psi[ijk] = F.F_Psi;
 
-    const auto igxx{(-gyz[ijk] * gyz[ijk] + gyy[ijk] * gzz[ijk]) / det_gamma};
-    const auto igxy{(gxz[ijk] * gyz[ijk] - gxy[ijk] * gzz[ijk]) / det_gamma};
-    const auto igxz{(gxy[ijk] * gyz[ijk] - (gxz[ijk] * gyy[ijk])) / det_gamma};
-    const auto igyy{(-gxz[ijk] * gxz[ijk] + gxx[ijk] * gzz[ijk]) / det_gamma};
-    const auto igyz{(gxy[ijk] * gxz[ijk] - gxx[ijk] * gyz[ijk]) / det_gamma};
-    const auto igzz{(-gxy[ijk] * gxy[ijk] + gxx[ijk] * gyy[ijk]) / det_gamma};
+    if constexpr (monitor) {
+      const CCTK_INT p[3]{i, j, k};
 
-    const auto sqrtg{std::sqrt(det_gamma)};
+      bool interior{true};
+      for (int d = 0; d < 3; d++) {
+        interior = interior && p[d] >= bndsize[2 * d] && p[d] < cctk_lsh[d] - bndsize[2 * d + 1];
+      }
 
-    F_Pi_x[ijk] = alp[ijk] * sqrtg * (igxx * Psi_x[ijk] + igxy * Psi_y[ijk] + igxz * Psi_z[ijk])
-                  - betax[ijk] * Pi[ijk];
-    F_Pi_y[ijk] = alp[ijk] * sqrtg * (igxy * Psi_x[ijk] + igyy * Psi_y[ijk] + igyz * Psi_z[ijk])
-                  - betay[ijk] * Pi[ijk];
-    F_Pi_z[ijk] = alp[ijk] * sqrtg * (igxz * Psi_x[ijk] + igyz * Psi_y[ijk] + igzz * Psi_z[ijk])
-                  - betaz[ijk] * Pi[ijk];
+      if (interior) {
+        const auto w{vw.weight ? vw.weight[ijk] : 1.0};
+        const auto detJ{determinant(J)};
+
+        /* The patch local cell volume is dx dy dz times the volume element in global
+         * coordinates */
+        energy += conserved_energy(FG, alp[ijk], m.sqrtg, Pi[ijk], Psi_x[ijk], Psi_y[ijk],
+                                   Psi_z[ijk], Phi[ijk], field_mass)
+                  * vw.volume_element(ijk, J) * dx[0] * dx[1] * dx[2];
+
+        /* F_Psi F_Pi^a / det(J) is the outgoing energy flux density through a local face */
+        const CCTK_REAL F_Pi_local[3]{F.F_Pi_a, F.F_Pi_b, F.F_Pi_c};
+        const auto orientation{std::copysign(1.0, detJ)};
+
+        for (int d = 0; d < 3; d++) {
+          const auto area{dx[(d + 1) % 3] * dx[(d + 2) % 3]};
+          const auto face_flux{w * orientation * F.F_Psi * F_Pi_local[d] * area};
+
+          if (is_physbnd[2 * d] && p[d] == bndsize[2 * d]) {
+            flux -= face_flux;
+          }
+
+          if (is_physbnd[2 * d + 1] && p[d] == cctk_lsh[d] - bndsize[2 * d + 1] - 1) {
+            flux += face_flux;
+          }
+        }
+      }
+    }
+  }
+  CCTK_ENDLOOP3_ALL(loop_flux);
+
+  if (monitor) {
+    energy_monitor_add(cctkGH, energy, flux);
+  }
+}
+
+} // namespace
+
+extern "C" void FCKleinGordon_calc_flux(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_PARAMETERS;
 
-    F_Psi[ijk] = alp[ijk] * Pi[ijk] / sqrtg
-                 - (betax[ijk] * Psi_x[ijk] + betay[ijk] * Psi_y[ijk] + betaz[ijk] * Psi_z[ijk]);
+  if (energy_monitor && fckg::energy_monitor_armed(cctkGH)) {
+    calc_flux<true>(CCTK_PASS_CTOC);
+  } else {
+    calc_flux<false>(CCTK_PASS_CTOC);
   }
-  CCTK_ENDLOOP3_INT(loop_flux);
 }
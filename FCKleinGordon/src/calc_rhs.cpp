@@ -1,21 +1,22 @@
-
 //clang-format off
 #include <cctk.h>
 #include <cctk_Arguments.h>
 #include <cctk_Parameters.h>
 //clang-format on
 
+#include "background.hpp"
 #include "derivatives.hpp"
-
-#include <cmath>
+#include "fluxes.hpp"
+#include "generated.hpp"
 
 #ifndef DECLARE_CCTK_ARGUMENTS_CHECKED
 #  define DECLARE_CCTK_ARGUMENTS_CHECKED(func) DECLARE_CCTK_ARGUMENTS
 #endif
 
-extern "C" void FCKleinGordon_calc_rhs(CCTK_ARGUMENTS) {
+namespace {
+
+template <std::size_t order> void calc_rhs(CCTK_ARGUMENTS) {
   using namespace fckg;
-  using std::sqrt;
 
   DECLARE_CCTK_ARGUMENTS_CHECKED(FCKleinGordon_calc_rhs);
   DECLARE_CCTK_PARAMETERS;
@@ -26,31 +27,52 @@ extern "C" void FCKleinGordon_calc_rhs(CCTK_ARGUMENTS) {
     const auto ijk{I(cctkGH, i, j, k)};
     const deriv_data dd{i, j, k, CCTK_DELTA_SPACE(0), CCTK_DELTA_SPACE(1), CCTK_DELTA_SPACE(2)};
 
-    const auto det_gamma{-(gxz[ijk] * gxz[ijk] * gyy[ijk]) + 2 * gxy[ijk] * gxz[ijk] * gyz[ijk]
-                         - gxx[ijk] * gyz[ijk] * gyz[ijk] - gxy[ijk] * gxy[ijk] * gzz[ijk]
-                         + gxx[ijk] * gyy[ijk] * gzz[ijk]};
+    const auto sqrtg{static_background ? sqrt_gamma[ijk]
+                                       : sqrt_det_gamma(gxx[ijk], gxy[ijk], gxz[ijk], gyy[ijk],
+                                                        gyz[ijk], gzz[ijk])};
 
-    const auto sqrtg{sqrt(det_gamma)};
+    const auto S{compute_sources(sqrtg, alp[ijk], betax[ijk], betay[ijk], betaz[ijk], Pi[ijk],
+                                 Psi_x[ijk], Psi_y[ijk], Psi_z[ijk], Phi[ijk], field_mass)};
 
-    const auto S_Pi{alp[ijk] * sqrtg * field_mass * field_mass * Phi[ijk]};
-    const auto S_Phi{(betax[ijk] * Psi_x[ijk] + betay[ijk] * Psi_y[ijk] + betaz[ijk] * Psi_z[ijk])
-                     - alp[ijk] * Pi[ijk] / sqrtg};
+    const jacobian J{J11[ijk], J12[ijk], J13[ijk], J21[ijk], J22[ijk],
+                     J23[ijk], J31[ijk], J32[ijk], J33[ijk]};
 
-    const auto dF_Pi_x_dx{global_Dx(cctkGH, dd, F_Pi_x, J11[ijk], J21[ijk], J31[ijk])};
-    const auto dF_Pi_y_dy{global_Dy(cctkGH, dd, F_Pi_y, J12[ijk], J22[ijk], J32[ijk])};
-    const auto dF_Pi_z_dz{global_Dz(cctkGH, dd, F_Pi_z, J13[ijk], J23[ijk], J33[ijk])};
+    /* Divergence of the densitized local fluxes, see fluxes.hpp */
+    const auto div_F_Pi{determinant(J)
+                        * (local_Dx<order>(cctkGH, dd, F_Pi_a) + local_Dy<order>(cctkGH, dd, F_Pi_b)
+                           + local_Dz<order>(cctkGH, dd, F_Pi_c))};
 
-    const auto dF_Psi_dx{global_Dx(cctkGH, dd, F_Psi, J11[ijk], J21[ijk], J31[ijk])};
-    const auto dF_Psi_dy{global_Dy(cctkGH, dd, F_Psi, J12[ijk], J22[ijk], J32[ijk])};
-    const auto dF_Psi_dz{global_Dz(cctkGH, dd, F_Psi, J13[ijk], J23[ijk], J33[ijk])};
+    const auto dF_Psi_da{local_Dx<order>(cctkGH, dd, F_Psi)};
+    const auto dF_Psi_db{local_Dy<order>(cctkGH, dd, F_Psi)};
+    const auto dF_Psi_dc{local_Dz<order>(cctkGH, dd, F_Psi)};
 
-    Pi_rhs[ijk] = S_Pi - (dF_Pi_x_dx + dF_Pi_y_dy + dF_Pi_z_dz);
+    Pi_rhs[ijk] = S.S_Pi - div_F_Pi;
 
-    Psi_x_rhs[ijk] = -dF_Psi_dx;
-    Psi_y_rhs[ijk] = -dF_Psi_dy;
-    Psi_z_rhs[ijk] = -dF_Psi_dz;
+    Psi_x_rhs[ijk] = -(J.J11 * dF_Psi_da + J.J21 * dF_Psi_db + J.J31 * dF_Psi_dc);
+    Psi_y_rhs[ijk] = -(J.J12 * dF_Psi_da + J.J22 * dF_Psi_db + J.J32 * dF_Psi_dc);
+    Psi_z_rhs[ijk] = -(J.J13 * dF_Psi_da + J.J23 * dF_Psi_db + J.J33 * dF_Psi_dc);
 
-    Phi_rhs[ijk] = S_Phi;
+    Phi_rhs[ijk] = S.S_Phi;
   }
   CCTK_ENDLOOP3_INT(loop_rhs);
 }
+
+} // namespace
+
+extern "C" void FCKleinGordon_calc_rhs(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_PARAMETERS;
+
+  switch (fd_order) {
+  case 4:
+    calc_rhs<4>(CCTK_PASS_CTOC);
+    break;
+  case 6:
+    calc_rhs<6>(CCTK_PASS_CTOC);
+    break;
+  case 8:
+    calc_rhs<8>(CCTK_PASS_CTOC);
+    break;
+  default:
+    CCTK_VERROR("Finite difference order %d is not implemented", static_cast<int>(fd_order));
+  }
+}
@@ -0,0 +1,70 @@
+#include <cctk.h>
+#include <cctk_Arguments.h>
+#include <cctk_Parameters.h>
+
+#include "background.hpp"
+#include "generated.hpp"
+
+#ifndef DECLARE_CCTK_ARGUMENTS_CHECKED
+#  define DECLARE_CCTK_ARGUMENTS_CHECKED(func) DECLARE_CCTK_ARGUMENTS
+#endif
+
+/*
+ * The first order system evolves Psi_i = d_i Phi and Pi, from which d_t Phi follows without
+ * derivatives. Tmunu and the energy density are therefore point-wise and are computed on
+ * every point, ghost zones included, without needing a synchronization.
+ *
+ * With zero shift the energy density T_tt is alp e / sqrt(g), with e the conserved_energy
+ * integrated by the energy monitor.
+ */
+
+extern "C" void FCKleinGordon_calc_tmunu(CCTK_ARGUMENTS) {
+  using namespace fckg;
+
+  DECLARE_CCTK_ARGUMENTS_CHECKED(FCKleinGordon_calc_tmunu);
+  DECLARE_CCTK_PARAMETERS;
+
+#pragma omp parallel
+  CCTK_LOOP3_ALL(loop_tmunu, cctkGH, i, j, k) {
+
+    const auto ijk{CCTK_GFINDEX3D(cctkGH, i, j, k)};
+
+    const tensor::sym3<CCTK_REAL> h{gxx[ijk], gxy[ijk], gxz[ijk], gyy[ijk], gyz[ijk], gzz[ijk]};
+
+    const auto T{compute_stress_energy(h, invert_metric(h.xx, h.xy, h.xz, h.yy, h.yz, h.zz),
+                                       alp[ijk], betax[ijk], betay[ijk], betaz[ijk], Pi[ijk],
+                                       Psi_x[ijk], Psi_y[ijk], Psi_z[ijk], Phi[ijk], field_mass)};
+
+    eTtt[ijk] += T.tt;
+    eTtx[ijk] += T.tx;
+    eTty[ijk] += T.ty;
+    eTtz[ijk] += T.tz;
+    eTxx[ijk] += T.xx;
+    eTxy[ijk] += T.xy;
+    eTxz[ijk] += T.xz;
+    eTyy[ijk] += T.yy;
+    eTyz[ijk] += T.yz;
+    eTzz[ijk] += T.zz;
+  }
+  CCTK_ENDLOOP3_ALL(loop_tmunu);
+}
+
+extern "C" void FCKleinGordon_calc_energy_density(CCTK_ARGUMENTS) {
+  using namespace fckg;
+
+  DECLARE_CCTK_ARGUMENTS_CHECKED(FCKleinGordon_calc_energy_density);
+  DECLARE_CCTK_PARAMETERS;
+
+#pragma omp parallel
+  CCTK_LOOP3_ALL(loop_energy_density, cctkGH, i, j, k) {
+
+    const auto ijk{CCTK_GFINDEX3D(cctkGH, i, j, k)};
+
+    const tensor::sym3<CCTK_REAL> h{gxx[ijk], gxy[ijk], gxz[ijk], gyy[ijk], gyz[ijk], gzz[ijk]};
+
+    rho_E[ijk] = fckg::compute_energy_density(
+        h, invert_metric(h.xx, h.xy, h.xz, h.yy, h.yz, h.zz), alp[ijk], betax[ijk], betay[ijk],
+        betaz[ijk], Pi[ijk], Psi_x[ijk], Psi_y[ijk], Psi_z[ijk], Phi[ijk], field_mass);
+  }
+  CCTK_ENDLOOP3_ALL(loop_energy_density);
+}
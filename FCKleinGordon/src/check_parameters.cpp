@@ -14,4 +14,24 @@ extern "C" void FCKleinGordon_check_parameters(CCTK_ARGUMENTS) {
     CCTK_PARAMWARN("The gaussian width parameter (W) is too small. Increase it in "
                    "order to avoid singularities.");
   }
+
+  for (int d = 0; d < 3; d++) {
+    if (cctk_nghostzones[d] < fd_order / 2) {
+      CCTK_VPARAMWARN("Order %d finite differencing requires at least %d ghost zones, but only "
+                      "%d are available in direction %d",
+                      static_cast<int>(fd_order), static_cast<int>(fd_order / 2),
+                      static_cast<int>(cctk_nghostzones[d]), d);
+    }
+  }
+
+  if (static_background && !CCTK_Equals(evolution_method, "static")) {
+    CCTK_PARAMWARN("A static background was requested but ADMBase::evolution_method is not "
+                   "\"static\". The cached background quantities would become stale.");
+  }
+
+  if (compute_error && !CCTK_EQUALS(initial_data, "exact_gaussian")) {
+    CCTK_PARAMWARN("Error computing was requested with initial data other than "
+                   "\"exact_gaussian\". The error is only significant when evolving "
+                   "\"exact_gaussian\" data in Minkowski space.");
+  }
 }
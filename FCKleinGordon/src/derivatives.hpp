@@ -2,7 +2,11 @@
 #define FC_KLEIN_GORDON_INITIAL_DERIVATIVES_HPP
 
 #include <cctk.h>
+
+#include <KleinGordonDerivatives.hpp>
+
 #include <cstddef>
+#include <utility>
 
 namespace fckg {
 
@@ -20,55 +24,55 @@ static inline auto I(cctkgh_t cctkGH, CCTK_INT i, CCTK_INT j, CCTK_INT k) noexce
   return CCTK_GFINDEX3D(cctkGH, i, j, k);
 }
 
+/*
+ * Weighted sum of the first derivative taps of kg::fd_coefficients, in increasing offset order
+ * as in KleinGordon's stencils. at(n) returns the value at offset n and taps with a zero weight
+ * are skipped.
+ */
+template <typename coefficients, typename tap_t, std::size_t... n>
+static inline auto first_derivative_sum(const tap_t &at, std::index_sequence<n...>) -> CCTK_REAL {
+  constexpr auto r{coefficients::radius};
+  return (CCTK_REAL{0} + ...
+          + (coefficients::first[n] != 0
+                 ? coefficients::first[n] * at(static_cast<CCTK_INT>(n) - r)
+                 : CCTK_REAL{0}));
+}
+
+/*
+ * Centered first derivative of the requested order along the grid direction (di, dj, dk),
+ * with grid spacing h.
+ */
+template <std::size_t order, CCTK_INT di, CCTK_INT dj, CCTK_INT dk, typename cctkgh_t,
+          typename cctk_gf_t>
+static inline auto local_D(cctkgh_t cctkGH, const deriv_data &d, const cctk_gf_t &f, CCTK_REAL h)
+    -> CCTK_REAL {
+  static_assert(order == 4 || order == 6 || order == 8,
+                "Only 4th, 6th and 8th order derivatives are implemented");
+
+  using coefficients = kg::fd_coefficients<static_cast<int>(order)>;
+
+  const auto at{[&](CCTK_INT n) { return f[I(cctkGH, d.i + n * di, d.j + n * dj, d.k + n * dk)]; }};
+
+  const auto den{1.0 / (coefficients::first_den * h)};
+  const auto num{first_derivative_sum<coefficients>(
+      at, std::make_index_sequence<coefficients::first.size()>{})};
+
+  return num * den;
+}
+
 template <std::size_t order, typename cctkgh_t, typename cctk_gf_t>
 static inline auto local_Dx(cctkgh_t cctkGH, const deriv_data &d, const cctk_gf_t &f) -> CCTK_REAL {
-  if constexpr (order == 4) {
-    const auto den{1.0 / (12.0 * d.dx)};
-    const auto num{-f[I(cctkGH, d.i + 2, d.j, d.k)] + 8 * f[I(cctkGH, d.i + 1, d.j, d.k)]
-                   - 8 * f[I(cctkGH, d.i - 1, d.j, d.k)] + f[I(cctkGH, d.i - 2, d.j, d.k)]};
-    return num * den;
-  }
+  return local_D<order, 1, 0, 0>(cctkGH, d, f, d.dx);
 }
 
 template <std::size_t order, typename cctkgh_t, typename cctk_gf_t>
 static inline auto local_Dy(cctkgh_t cctkGH, const deriv_data &d, const cctk_gf_t &f) -> CCTK_REAL {
-  if constexpr (order == 4) {
-    const auto den{1.0 / (12.0 * d.dy)};
-    const auto num{-f[I(cctkGH, d.i, d.j + 2, d.k)] + 8 * f[I(cctkGH, d.i, d.j + 1, d.k)]
-                   - 8 * f[I(cctkGH, d.i, d.j - 1, d.k)] + f[I(cctkGH, d.i, d.j - 2, d.k)]};
-    return num * den;
-  }
+  return local_D<order, 0, 1, 0>(cctkGH, d, f, d.dy);
 }
 
 template <std::size_t order, typename cctkgh_t, typename cctk_gf_t>
 static inline auto local_Dz(cctkgh_t cctkGH, const deriv_data &d, const cctk_gf_t &f) -> CCTK_REAL {
-  if constexpr (order == 4) {
-    const auto den{1.0 / (12.0 * d.dz)};
-    const auto num{-f[I(cctkGH, d.i, d.j, d.k + 2)] + 8 * f[I(cctkGH, d.i, d.j, d.k + 1)]
-                   - 8 * f[I(cctkGH, d.i, d.j, d.k - 1)] + f[I(cctkGH, d.i, d.j, d.k - 2)]};
-    return num * den;
-  }
-}
-
-template <std::size_t order = 4, typename cctkgh_t, typename cctk_gf_t>
-static inline auto global_Dx(cctkgh_t cctkGH, const deriv_data &d, const cctk_gf_t &f,
-                             CCTK_REAL J11, CCTK_REAL J21, CCTK_REAL J31) -> CCTK_REAL {
-  return J11 * local_Dx<order>(cctkGH, d, f) + J21 * local_Dy<order>(cctkGH, d, f)
-         + J31 * local_Dz<order>(cctkGH, d, f);
-}
-
-template <std::size_t order = 4, typename cctkgh_t, typename cctk_gf_t>
-static inline auto global_Dy(cctkgh_t cctkGH, const deriv_data &d, const cctk_gf_t &f,
-                             CCTK_REAL J12, CCTK_REAL J22, CCTK_REAL J32) -> CCTK_REAL {
-  return J12 * local_Dx<order>(cctkGH, d, f) + J22 * local_Dy<order>(cctkGH, d, f)
-         + J32 * local_Dz<order>(cctkGH, d, f);
-}
-
-template <std::size_t order = 4, typename cctkgh_t, typename cctk_gf_t>
-static inline auto global_Dz(cctkgh_t cctkGH, const deriv_data &d, const cctk_gf_t &f,
-                             CCTK_REAL J13, CCTK_REAL J23, CCTK_REAL J33) -> CCTK_REAL {
-  return J13 * local_Dx<order>(cctkGH, d, f) + J23 * local_Dy<order>(cctkGH, d, f)
-         + J33 * local_Dz<order>(cctkGH, d, f);
+  return local_D<order, 0, 0, 1>(cctkGH, d, f, d.dz);
 }
 
 } // namespace fckg
@@ -0,0 +1,63 @@
+#include <cctk.h>
+#include <cctk_Arguments.h>
+#include <cctk_Functions.h>
+#include <cctk_Parameters.h>
+
+#include "energy_monitor.hpp"
+
+#include <KleinGordonReductions.hpp>
+
+#ifndef DECLARE_CCTK_ARGUMENTS_CHECKED
+#  define DECLARE_CCTK_ARGUMENTS_CHECKED(func) DECLARE_CCTK_ARGUMENTS
+#endif
+
+namespace {
+
+struct level_sums {
+  bool armed;
+  CCTK_REAL energy;
+  CCTK_REAL flux;
+};
+
+reduction::per_level<level_sums> sums{};
+
+} // namespace
+
+auto fckg::energy_monitor_armed(const cGH *cctkGH) -> bool { return sums.current(cctkGH).armed; }
+
+void fckg::energy_monitor_add(const cGH *cctkGH, CCTK_REAL energy, CCTK_REAL flux) {
+  auto &level{sums.current(cctkGH)};
+  level.energy += energy;
+  level.flux += flux;
+}
+
+extern "C" void FCKleinGordon_energy_monitor_arm(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS_CHECKED(FCKleinGordon_energy_monitor_arm);
+
+  sums.current(cctkGH) = level_sums{true, 0.0, 0.0};
+}
+
+/*
+ * Sums the contributions of all processes and stores them in the grid scalars of the
+ * current refinement level. Points covered by finer levels carry zero weight, so the total
+ * energy of the grid hierarchy is the sum over the levels at times when they are aligned.
+ */
+extern "C" void FCKleinGordon_energy_monitor_reduce(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS_CHECKED(FCKleinGordon_energy_monitor_reduce);
+
+  auto &level{sums.current(cctkGH)};
+
+  if (!level.armed) {
+    return;
+  }
+
+  const CCTK_REAL local[2]{level.energy, level.flux};
+  CCTK_REAL global[2]{0.0, 0.0};
+
+  reduction::reduce(cctkGH, "sum", local, global, 2, "the energy monitor sums");
+
+  *field_energy = global[0];
+  *boundary_energy_flux = global[1];
+
+  level = level_sums{false, 0.0, 0.0};
+}
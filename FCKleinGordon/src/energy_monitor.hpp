@@ -0,0 +1,19 @@
+#ifndef FC_KLEIN_GORDON_ENERGY_MONITOR_HPP
+#define FC_KLEIN_GORDON_ENERGY_MONITOR_HPP
+
+#include <cctk.h>
+
+namespace fckg {
+
+/*
+ * Process local accumulators of the energy monitor. calc_flux adds the contribution of each
+ * local component while the current refinement level is armed, i.e. during the first MoL
+ * substep, when the state is still the one at the beginning of the time step.
+ */
+auto energy_monitor_armed(const cGH *cctkGH) -> bool;
+
+void energy_monitor_add(const cGH *cctkGH, CCTK_REAL energy, CCTK_REAL flux);
+
+} // namespace fckg
+
+#endif // FC_KLEIN_GORDON_ENERGY_MONITOR_HPP
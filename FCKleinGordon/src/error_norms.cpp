@@ -0,0 +1,65 @@
+#include <cctk.h>
+#include <cctk_Arguments.h>
+#include <cctk_Functions.h>
+#include <cctk_Parameters.h>
+
+#include "background.hpp"
+
+#include <KleinGordonAnalyticSolutions.hpp>
+#include <KleinGordonReductions.hpp>
+
+#include <array>
+#include <cmath>
+
+#ifndef DECLARE_CCTK_ARGUMENTS_CHECKED
+#  define DECLARE_CCTK_ARGUMENTS_CHECKED(func) DECLARE_CCTK_ARGUMENTS
+#endif
+
+/*
+ * Norms of the error with respect to the exact gaussian, reduced directly from the state
+ * without storing error grid functions.
+ */
+
+namespace {
+
+reduction::per_level<reduction::norm_sums<2>> sums{};
+
+} // namespace
+
+extern "C" void FCKleinGordon_error_norms(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS_CHECKED(FCKleinGordon_error_norms);
+  DECLARE_CCTK_PARAMETERS;
+
+  const CCTK_REAL t{cctk_time};
+
+  reduction::add_norms(cctkGH, sums.current(cctkGH), [&](CCTK_INT ijk) {
+    const auto s{analytic::exact_gaussian(t, x[ijk] - x0, y[ijk] - y0, z[ijk] - z0, A, W)};
+
+    const auto sqrtg{
+        fckg::sqrt_det_gamma(gxx[ijk], gxy[ijk], gxz[ijk], gyy[ijk], gyz[ijk], gzz[ijk])};
+
+    const auto analytic_Pi{sqrtg / alp[ijk]
+                           * (betax[ijk] * s.d_x_Phi + betay[ijk] * s.d_y_Phi
+                              + betaz[ijk] * s.d_z_Phi - s.d_t_Phi)};
+
+    return std::array<CCTK_REAL, 2>{std::fabs(Phi[ijk] - s.Phi), std::fabs(Pi[ijk] - analytic_Pi)};
+  });
+}
+
+extern "C" void FCKleinGordon_reduce_error_norms(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS_CHECKED(FCKleinGordon_reduce_error_norms);
+
+  auto &level{sums.current(cctkGH)};
+
+  const auto [Phi_norms, Pi_norms]{reduction::reduce_norms(cctkGH, level)};
+
+  *Phi_err_norm1 = Phi_norms.norm1;
+  *Phi_err_norm2 = Phi_norms.norm2;
+  *Phi_err_norm_inf = Phi_norms.norm_inf;
+
+  *Pi_err_norm1 = Pi_norms.norm1;
+  *Pi_err_norm2 = Pi_norms.norm2;
+  *Pi_err_norm_inf = Pi_norms.norm_inf;
+
+  level = reduction::norm_sums<2>{};
+}
@@ -0,0 +1,61 @@
+#ifndef FC_KLEIN_GORDON_FLUXES_HPP
+#define FC_KLEIN_GORDON_FLUXES_HPP
+
+#include "background.hpp"
+#include "generated.hpp"
+
+#include <cctk.h>
+
+namespace fckg {
+
+/*
+ * Jacobian J_ai = d a / d x^i of the patch local coordinates, in the storage order of the
+ * Coordinates::jacobian group, i.e. J12 = d a / d y.
+ */
+struct jacobian {
+  CCTK_REAL J11, J12, J13;
+  CCTK_REAL J21, J22, J23;
+  CCTK_REAL J31, J32, J33;
+};
+
+inline auto determinant(const jacobian &J) noexcept -> CCTK_REAL {
+  return J.J11 * (J.J22 * J.J33 - J.J23 * J.J32) - J.J12 * (J.J21 * J.J33 - J.J23 * J.J31)
+         + J.J13 * (J.J21 * J.J32 - J.J22 * J.J31);
+}
+
+/*
+ * Fluxes in the form differentiated by calc_rhs. The vector flux of Pi is stored as its
+ * densitized patch local components F^a / det(J) = J_ai F^i / det(J). By the Piola
+ * identity d_i F^i = det(J) d_a (F^a / det(J)), so its divergence takes one local
+ * derivative per direction and telescopes exactly along every patch direction.
+ */
+struct local_fluxes {
+  CCTK_REAL F_Pi_a, F_Pi_b, F_Pi_c, F_Psi;
+};
+
+inline auto densitize(const jacobian &J, const fluxes &F) noexcept -> local_fluxes {
+  const auto idetJ{1 / determinant(J)};
+
+  return {(J.J11 * F.F_Pi_x + J.J12 * F.F_Pi_y + J.J13 * F.F_Pi_z) * idetJ,
+          (J.J21 * F.F_Pi_x + J.J22 * F.F_Pi_y + J.J23 * F.F_Pi_z) * idetJ,
+          (J.J31 * F.F_Pi_x + J.J32 * F.F_Pi_y + J.J33 * F.F_Pi_z) * idetJ, F.F_Psi};
+}
+
+/*
+ * Energy density conserved by the first order system on a time independent background,
+ *
+ *   e = (alp Pi^2 / sqrtg + alp sqrtg (g^ij Psi_i Psi_j + m^2 Phi^2)) / 2 - Pi beta^i Psi_i,
+ *
+ * written in terms of the global fluxes. It satisfies d_t e + d_i (F_Psi F_Pi^i) = 0.
+ */
+inline auto conserved_energy(const fluxes &F, CCTK_REAL alpL, CCTK_REAL sqrtg, CCTK_REAL PiL,
+                             CCTK_REAL Psi_xL, CCTK_REAL Psi_yL, CCTK_REAL Psi_zL,
+                             CCTK_REAL PhiL, CCTK_REAL field_mass) noexcept -> CCTK_REAL {
+  return 0.5
+         * (PiL * F.F_Psi + Psi_xL * F.F_Pi_x + Psi_yL * F.F_Pi_y + Psi_zL * F.F_Pi_z
+            + alpL * sqrtg * field_mass * field_mass * PhiL * PhiL);
+}
+
+} // namespace fckg
+
+#endif // FC_KLEIN_GORDON_FLUXES_HPP
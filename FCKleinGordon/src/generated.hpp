@@ -0,0 +1,178 @@
+/*
+ * Fluxes and sources of the first order system, the energy momentum tensor and the
+ * energy density.
+ *
+ * Generated by Notebooks/generate_kernels.py. Do not edit by hand.
+ */
+
+#ifndef FC_KLEIN_GORDON_GENERATED_HPP
+#define FC_KLEIN_GORDON_GENERATED_HPP
+
+#include "background.hpp"
+
+#include <cctk.h>
+#include <cmath>
+
+namespace fckg {
+
+struct fluxes {
+  CCTK_REAL F_Pi_x, F_Pi_y, F_Pi_z, F_Psi;
+};
+
+/* Fluxes of the first order system */
+inline fluxes compute_fluxes(const metric_inverse &m, CCTK_REAL alpL, CCTK_REAL betaxL,
+                             CCTK_REAL betayL, CCTK_REAL betazL, CCTK_REAL PiL, CCTK_REAL Psi_xL,
+                             CCTK_REAL Psi_yL, CCTK_REAL Psi_zL) {
+  const CCTK_REAL igxx = m.ig.xx;
+  const CCTK_REAL igxy = m.ig.xy;
+  const CCTK_REAL igxz = m.ig.xz;
+  const CCTK_REAL igyy = m.ig.yy;
+  const CCTK_REAL igyz = m.ig.yz;
+  const CCTK_REAL igzz = m.ig.zz;
+  const CCTK_REAL sqrtg = m.sqrtg;
+
+  const CCTK_REAL t0 = alpL * sqrtg;
+  const CCTK_REAL t1 = Psi_xL * t0;
+  const CCTK_REAL t2 = Psi_yL * t0;
+  const CCTK_REAL t3 = Psi_zL * t0;
+
+  const CCTK_REAL F_Pi_x = -PiL * betaxL + igxx * t1 + igxy * t2 + igxz * t3;
+  const CCTK_REAL F_Pi_y = -PiL * betayL + igxy * t1 + igyy * t2 + igyz * t3;
+  const CCTK_REAL F_Pi_z = -PiL * betazL + igxz * t1 + igyz * t2 + igzz * t3;
+  const CCTK_REAL F_Psi = PiL * alpL / sqrtg - Psi_xL * betaxL - Psi_yL * betayL - Psi_zL * betazL;
+
+  return {F_Pi_x, F_Pi_y, F_Pi_z, F_Psi};
+}
+
+struct source_terms {
+  CCTK_REAL S_Pi, S_Phi;
+};
+
+/* Sources of the first order system */
+inline source_terms compute_sources(CCTK_REAL sqrtg, CCTK_REAL alpL, CCTK_REAL betaxL,
+                                    CCTK_REAL betayL, CCTK_REAL betazL, CCTK_REAL PiL,
+                                    CCTK_REAL Psi_xL, CCTK_REAL Psi_yL, CCTK_REAL Psi_zL,
+                                    CCTK_REAL PhiL, CCTK_REAL field_mass) {
+  const CCTK_REAL S_Pi = PhiL * alpL * field_mass * field_mass * sqrtg;
+  const CCTK_REAL S_Phi = -PiL * alpL / sqrtg + Psi_xL * betaxL + Psi_yL * betayL + Psi_zL * betazL;
+
+  return {S_Pi, S_Phi};
+}
+
+struct stress_energy_tensor {
+  CCTK_REAL tt, tx, ty, tz, xx, xy, xz, yy, yz, zz;
+};
+
+/*
+ * Energy momentum tensor of the field, T_ab = d_a Phi d_b Phi + g_ab L / 2,
+ * with L = -m^2 Phi^2 - g^{ab} d_a Phi d_b Phi.
+ */
+inline stress_energy_tensor compute_stress_energy(const tensor::sym3<CCTK_REAL> &h,
+                                                  const metric_inverse &m, CCTK_REAL alpL,
+                                                  CCTK_REAL betaxL, CCTK_REAL betayL,
+                                                  CCTK_REAL betazL, CCTK_REAL PiL, CCTK_REAL Psi_xL,
+                                                  CCTK_REAL Psi_yL, CCTK_REAL Psi_zL,
+                                                  CCTK_REAL PhiL, CCTK_REAL field_mass) {
+  const CCTK_REAL hxxL = h.xx;
+  const CCTK_REAL hxyL = h.xy;
+  const CCTK_REAL hxzL = h.xz;
+  const CCTK_REAL hyyL = h.yy;
+  const CCTK_REAL hyzL = h.yz;
+  const CCTK_REAL hzzL = h.zz;
+  const CCTK_REAL ihxxL = m.ig.xx;
+  const CCTK_REAL ihxyL = m.ig.xy;
+  const CCTK_REAL ihxzL = m.ig.xz;
+  const CCTK_REAL ihyyL = m.ig.yy;
+  const CCTK_REAL ihyzL = m.ig.yz;
+  const CCTK_REAL ihzzL = m.ig.zz;
+  const CCTK_REAL sqrtg = m.sqrtg;
+
+  const CCTK_REAL t0 = alpL * alpL;
+  const CCTK_REAL t1 = Psi_xL * betaxL + Psi_yL * betayL + Psi_zL * betazL;
+  const CCTK_REAL t2 = 1.0 / t0;
+  const CCTK_REAL t3 = betaxL * t2;
+  const CCTK_REAL t4 = -betayL * t3 + ihxyL;
+  const CCTK_REAL t5 = -betazL * t3 + ihxzL;
+  const CCTK_REAL t6 = betayL * t2;
+  const CCTK_REAL t7 = -betazL * t6 + ihyzL;
+  const CCTK_REAL ibetaxL = betaxL * hxxL + betayL * hxyL + betazL * hxzL;
+  const CCTK_REAL ibetayL = betaxL * hxyL + betayL * hyyL + betazL * hyzL;
+  const CCTK_REAL ibetazL = betaxL * hxzL + betayL * hyzL + betazL * hzzL;
+  const CCTK_REAL gttL = betaxL * ibetaxL + betayL * ibetayL + betazL * ibetazL - t0;
+  const CCTK_REAL d_t_Phi = -PiL * alpL / sqrtg + t1;
+  const CCTK_REAL t8 = d_t_Phi * t2;
+  const CCTK_REAL L
+      = -PhiL * PhiL * field_mass * field_mass
+        - Psi_xL
+          * (Psi_xL * (-betaxL * betaxL * t2 + ihxxL) + Psi_yL * t4 + Psi_zL * t5 + d_t_Phi * t3)
+        - Psi_yL
+          * (Psi_xL * t4 + Psi_yL * (-betayL * betayL * t2 + ihyyL) + Psi_zL * t7 + d_t_Phi * t6)
+        - Psi_zL
+          * (Psi_xL * t5 + Psi_yL * t7 + Psi_zL * (-betazL * betazL * t2 + ihzzL) + betazL * t8)
+        - t8 * (-d_t_Phi + t1);
+  const CCTK_REAL t9 = 0.5 * L;
+
+  const CCTK_REAL tt = d_t_Phi * d_t_Phi + gttL * t9;
+  const CCTK_REAL tx = Psi_xL * d_t_Phi + ibetaxL * t9;
+  const CCTK_REAL ty = Psi_yL * d_t_Phi + ibetayL * t9;
+  const CCTK_REAL tz = Psi_zL * d_t_Phi + ibetazL * t9;
+  const CCTK_REAL xx = Psi_xL * Psi_xL + hxxL * t9;
+  const CCTK_REAL xy = Psi_xL * Psi_yL + hxyL * t9;
+  const CCTK_REAL xz = Psi_xL * Psi_zL + hxzL * t9;
+  const CCTK_REAL yy = Psi_yL * Psi_yL + hyyL * t9;
+  const CCTK_REAL yz = Psi_yL * Psi_zL + hyzL * t9;
+  const CCTK_REAL zz = Psi_zL * Psi_zL + hzzL * t9;
+
+  return {tt, tx, ty, tz, xx, xy, xz, yy, yz, zz};
+}
+
+/* Energy density of the field, T_tt */
+inline CCTK_REAL compute_energy_density(const tensor::sym3<CCTK_REAL> &h, const metric_inverse &m,
+                                        CCTK_REAL alpL, CCTK_REAL betaxL, CCTK_REAL betayL,
+                                        CCTK_REAL betazL, CCTK_REAL PiL, CCTK_REAL Psi_xL,
+                                        CCTK_REAL Psi_yL, CCTK_REAL Psi_zL, CCTK_REAL PhiL,
+                                        CCTK_REAL field_mass) {
+  const CCTK_REAL hxxL = h.xx;
+  const CCTK_REAL hxyL = h.xy;
+  const CCTK_REAL hxzL = h.xz;
+  const CCTK_REAL hyyL = h.yy;
+  const CCTK_REAL hyzL = h.yz;
+  const CCTK_REAL hzzL = h.zz;
+  const CCTK_REAL ihxxL = m.ig.xx;
+  const CCTK_REAL ihxyL = m.ig.xy;
+  const CCTK_REAL ihxzL = m.ig.xz;
+  const CCTK_REAL ihyyL = m.ig.yy;
+  const CCTK_REAL ihyzL = m.ig.yz;
+  const CCTK_REAL ihzzL = m.ig.zz;
+  const CCTK_REAL sqrtg = m.sqrtg;
+
+  const CCTK_REAL t0 = alpL * alpL;
+  const CCTK_REAL t1 = Psi_xL * betaxL + Psi_yL * betayL + Psi_zL * betazL;
+  const CCTK_REAL t2 = 1.0 / t0;
+  const CCTK_REAL t3 = betaxL * t2;
+  const CCTK_REAL t4 = -betayL * t3 + ihxyL;
+  const CCTK_REAL t5 = -betazL * t3 + ihxzL;
+  const CCTK_REAL t6 = betayL * t2;
+  const CCTK_REAL t7 = -betazL * t6 + ihyzL;
+  const CCTK_REAL ibetaxL = betaxL * hxxL + betayL * hxyL + betazL * hxzL;
+  const CCTK_REAL ibetayL = betaxL * hxyL + betayL * hyyL + betazL * hyzL;
+  const CCTK_REAL ibetazL = betaxL * hxzL + betayL * hyzL + betazL * hzzL;
+  const CCTK_REAL gttL = betaxL * ibetaxL + betayL * ibetayL + betazL * ibetazL - t0;
+  const CCTK_REAL d_t_Phi = -PiL * alpL / sqrtg + t1;
+  const CCTK_REAL t8 = d_t_Phi * t2;
+  const CCTK_REAL L
+      = -PhiL * PhiL * field_mass * field_mass
+        - Psi_xL
+          * (Psi_xL * (-betaxL * betaxL * t2 + ihxxL) + Psi_yL * t4 + Psi_zL * t5 + d_t_Phi * t3)
+        - Psi_yL
+          * (Psi_xL * t4 + Psi_yL * (-betayL * betayL * t2 + ihyyL) + Psi_zL * t7 + d_t_Phi * t6)
+        - Psi_zL
+          * (Psi_xL * t5 + Psi_yL * t7 + Psi_zL * (-betazL * betazL * t2 + ihzzL) + betazL * t8)
+        - t8 * (-d_t_Phi + t1);
+
+  return 0.5 * L * gttL + d_t_Phi * d_t_Phi;
+}
+
+} // namespace fckg
+
+#endif /* FC_KLEIN_GORDON_GENERATED_HPP */
@@ -2,6 +2,10 @@
 #include <cctk_Arguments.h>
 #include <cctk_Parameters.h>
 
+#include "background.hpp"
+
+#include <KleinGordonAnalyticSolutions.hpp>
+
 #ifndef DECLARE_CCTK_ARGUMENTS_CHECKED
 #  define DECLARE_CCTK_ARGUMENTS_CHECKED(func) DECLARE_CCTK_ARGUMENTS
 #endif
@@ -12,45 +16,38 @@ template <typename T> static T base_gaussian(T A, T W, T r) noexcept {
 }
 
 extern "C" void FCKleinGordon_initialize(CCTK_ARGUMENTS) {
-  using std::cos;
-  using std::sin;
   using std::sqrt;
 
   DECLARE_CCTK_ARGUMENTS_CHECKED(FCKleinGordon_initialize);
   DECLARE_CCTK_PARAMETERS;
 
   if (CCTK_EQUALS(initial_data, "standing_wave")) {
-#pragma omp parallel
-    CCTK_LOOP3_ALL(loop_stnading_wave, cctkGH, i, j, k) {
-
-      const auto ijk{CCTK_GFINDEX3D(cctkGH, i, j, k)};
-
-      const auto detgamma{-(gxz[ijk] * gxz[ijk] * gyy[ijk]) + 2 * gxy[ijk] * gxz[ijk] * gyz[ijk]
-                          - gxx[ijk] * gyz[ijk] * gyz[ijk] - gxy[ijk] * gxy[ijk] * gzz[ijk]
-                          + gxx[ijk] * gyy[ijk] * gzz[ijk]};
+    const CCTK_REAL t{cctk_time};
 
-      const auto sqrtg{sqrt(detgamma)};
+#pragma omp parallel for collapse(2)
+    for (CCTK_INT k = 0; k < cctk_lsh[2]; k++) {
+      for (CCTK_INT j = 0; j < cctk_lsh[1]; j++) {
+#pragma omp simd
+        for (CCTK_INT i = 0; i < cctk_lsh[0]; i++) {
+          const auto ijk{CCTK_GFINDEX3D(cctkGH, i, j, k)};
 
-      const auto Psi_xL{-2 * A * kx * M_PI * cos(2 * M_PI * ky * y[ijk])
-                        * cos(2 * M_PI * kz * z[ijk]) * sin(2 * M_PI * kx * x[ijk])};
+          const auto s{analytic::standing_wave(t, x[ijk], y[ijk], z[ijk], A, kx, ky, kz)};
 
-      const auto Psi_yL{-2 * A * ky * M_PI * cos(2 * M_PI * kx * x[ijk])
-                        * cos(2 * M_PI * kz * z[ijk]) * sin(2 * M_PI * ky * y[ijk])};
+          const auto sqrtg{
+              fckg::sqrt_det_gamma(gxx[ijk], gxy[ijk], gxz[ijk], gyy[ijk], gyz[ijk], gzz[ijk])};
 
-      const auto Psi_zL{-2 * A * kz * M_PI * cos(2 * M_PI * kx * x[ijk])
-                        * cos(2 * M_PI * ky * y[ijk]) * sin(2 * M_PI * kz * z[ijk])};
+          Phi[ijk] = s.Phi;
 
-      Phi[ijk] = A * cos(2 * M_PI * kx * x[ijk]) * cos(2 * M_PI * ky * y[ijk])
-                 * cos(2 * M_PI * kz * z[ijk]);
-
-      Psi_x[ijk] = Psi_xL;
-      Psi_y[ijk] = Psi_yL;
-      Psi_z[ijk] = Psi_zL;
+          Psi_x[ijk] = s.d_x_Phi;
+          Psi_y[ijk] = s.d_y_Phi;
+          Psi_z[ijk] = s.d_z_Phi;
 
-      Pi[ijk]
-          = sqrtg / alp[ijk] * (betax[ijk] * Psi_xL + betay[ijk] * Psi_yL + betaz[ijk] * Psi_zL);
+          Pi[ijk] = sqrtg / alp[ijk]
+                    * (betax[ijk] * s.d_x_Phi + betay[ijk] * s.d_y_Phi + betaz[ijk] * s.d_z_Phi
+                       - s.d_t_Phi);
+        }
+      }
     }
-    CCTK_ENDLOOP3_ALL(loop_stnading_wave);
 
   } else if (CCTK_EQUALS(initial_data, "gaussian")) {
 #pragma omp parallel
@@ -68,11 +65,8 @@ extern "C" void FCKleinGordon_initialize(CCTK_ARGUMENTS) {
 
       const auto gaussian{base_gaussian(A, W, rL)};
 
-      const auto detgamma{-(gxz[ijk] * gxz[ijk] * gyy[ijk]) + 2 * gxy[ijk] * gxz[ijk] * gyz[ijk]
-                          - gxx[ijk] * gyz[ijk] * gyz[ijk] - gxy[ijk] * gxy[ijk] * gzz[ijk]
-                          + gxx[ijk] * gyy[ijk] * gzz[ijk]};
-
-      const auto sqrtg{sqrt(detgamma)};
+      const auto sqrtg{
+          fckg::sqrt_det_gamma(gxx[ijk], gxy[ijk], gxz[ijk], gyy[ijk], gyz[ijk], gzz[ijk])};
 
       const auto Psi_xL{xL / (W * W) * gaussian};
       const auto Psi_yL{yL / (W * W) * gaussian};
@@ -89,5 +83,34 @@ extern "C" void FCKleinGordon_initialize(CCTK_ARGUMENTS) {
                    + (betaz[ijk] - zL_over_rL) * Psi_zL);
     }
     CCTK_ENDLOOP3_ALL(loop_gaussian);
+
+  } else if (CCTK_EQUALS(initial_data, "exact_gaussian")) {
+    const CCTK_REAL t{cctk_time};
+
+#pragma omp parallel for collapse(2)
+    for (CCTK_INT k = 0; k < cctk_lsh[2]; k++) {
+      for (CCTK_INT j = 0; j < cctk_lsh[1]; j++) {
+#pragma omp simd
+        for (CCTK_INT i = 0; i < cctk_lsh[0]; i++) {
+          const auto ijk{CCTK_GFINDEX3D(cctkGH, i, j, k)};
+
+          const auto s{
+              analytic::exact_gaussian(t, x[ijk] - x0, y[ijk] - y0, z[ijk] - z0, A, W)};
+
+          const auto sqrtg{
+              fckg::sqrt_det_gamma(gxx[ijk], gxy[ijk], gxz[ijk], gyy[ijk], gyz[ijk], gzz[ijk])};
+
+          Phi[ijk] = s.Phi;
+
+          Psi_x[ijk] = s.d_x_Phi;
+          Psi_y[ijk] = s.d_y_Phi;
+          Psi_z[ijk] = s.d_z_Phi;
+
+          Pi[ijk] = sqrtg / alp[ijk]
+                    * (betax[ijk] * s.d_x_Phi + betay[ijk] * s.d_y_Phi + betaz[ijk] * s.d_z_Phi
+                       - s.d_t_Phi);
+        }
+      }
+    }
   }
 }
@@ -14,17 +14,20 @@ extern "C" void FCKleinGordon_MoL_register(CCTK_ARGUMENTS) {
 
   /*
    * Save and restore variables are those that a thorn depends on but
-   * does not set or evolve.
+   * does not set or evolve. A static background never changes, so there
+   * is nothing to save or restore in that case.
    */
-  const CCTK_INT lapse_group_idx = CCTK_GroupIndex("ADMBase::lapse");
-  const CCTK_INT shift_group_idx = CCTK_GroupIndex("ADMBase::shift");
-  const CCTK_INT metric_group_idx = CCTK_GroupIndex("ADMBase::metric");
-  const CCTK_INT curv_group_idx = CCTK_GroupIndex("ADMBase::curv");
-
-  ierr += MoLRegisterSaveAndRestoreGroup(lapse_group_idx);
-  ierr += MoLRegisterSaveAndRestoreGroup(shift_group_idx);
-  ierr += MoLRegisterSaveAndRestoreGroup(metric_group_idx);
-  ierr += MoLRegisterSaveAndRestoreGroup(curv_group_idx);
+  if (!static_background) {
+    const CCTK_INT lapse_group_idx = CCTK_GroupIndex("ADMBase::lapse");
+    const CCTK_INT shift_group_idx = CCTK_GroupIndex("ADMBase::shift");
+    const CCTK_INT metric_group_idx = CCTK_GroupIndex("ADMBase::metric");
+    const CCTK_INT curv_group_idx = CCTK_GroupIndex("ADMBase::curv");
+
+    ierr += MoLRegisterSaveAndRestoreGroup(lapse_group_idx);
+    ierr += MoLRegisterSaveAndRestoreGroup(shift_group_idx);
+    ierr += MoLRegisterSaveAndRestoreGroup(metric_group_idx);
+    ierr += MoLRegisterSaveAndRestoreGroup(curv_group_idx);
+  }
 
   /*
    * Here we register the evolved variables.
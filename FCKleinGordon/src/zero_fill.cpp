@@ -31,10 +31,23 @@ extern "C" void FCKleinGordon_zero_flux(CCTK_ARGUMENTS) {
   CCTK_LOOP3_ALL(loop_zero_rhs, cctkGH, i, j, k) {
     const CCTK_INT ijk = CCTK_GFINDEX3D(cctkGH, i, j, k);
 
-    F_Pi_x[ijk] = 0.0;
-    F_Pi_y[ijk] = 0.0;
-    F_Pi_z[ijk] = 0.0;
+    F_Pi_a[ijk] = 0.0;
+    F_Pi_b[ijk] = 0.0;
+    F_Pi_c[ijk] = 0.0;
     F_Psi[ijk] = 0.0;
   }
   CCTK_ENDLOOP3_ALL(loop_zero_rhs);
+}
+
+extern "C" void FCKleinGordon_zero_energy_density(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS_CHECKED(FCKleinGordon_zero_energy_density);
+  DECLARE_CCTK_PARAMETERS;
+
+#pragma omp parallel
+  CCTK_LOOP3_ALL(loop_zero_energy_density, cctkGH, i, j, k) {
+    const CCTK_INT ijk = CCTK_GFINDEX3D(cctkGH, i, j, k);
+
+    rho_E[ijk] = 0.0;
+  }
+  CCTK_ENDLOOP3_ALL(loop_zero_energy_density);
 }
\ No newline at end of file
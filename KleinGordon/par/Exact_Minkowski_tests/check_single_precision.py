@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+#
+#  FieldPerturbations - Thorns for field evolutions in arbitrary space-times
+#  Copyright (C) 2021  Lucas Timotheo Sanches
+#
+#  This program is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+# check_single_precision.py
+# Checks the three runs of Minkowski_single_precision_order_4.par. The
+# norm2 and norm_inf of Phi_err and K_Phi_err at the final time are read
+# from the CarpetIOScalar output of each run, and the test passes if
+#
+#  - the single precision errors converge at the finite difference order
+#    between $resolution_factor = 1 and 2, and
+#  - the single and double precision errors at $resolution_factor = 1
+#    agree to a small fraction of the error itself.
+#
+# Usage:
+#
+#   python3 check_single_precision.py <single, res 1> <single, res 2> <double, res 1>
+#
+# where each argument is the output directory of a run, searched recursively.
+# The exit status is 0 if every check passes and 1 otherwise.
+
+import argparse
+import glob
+import math
+import os
+import sys
+
+VARIABLES = ["phi_err", "k_phi_err"]
+REDUCTIONS = ["norm2", "norm_inf"]
+
+
+def final_value(directory, variable, reduction):
+    """
+    Returns (time, value) of the last output of variable.reduction.asc under
+    directory. Restarts may spread the output over several files, the latest
+    time among all of them is used.
+    """
+    name = f"{variable}.{reduction}.asc"
+    paths = [
+        p
+        for p in glob.glob(os.path.join(directory, "**", "*.asc"), recursive=True)
+        if os.path.basename(p).lower() == name
+    ]
+
+    if not paths:
+        sys.exit(f"No {name} found under {directory}")
+
+    rows = []
+    for path in paths:
+        with open(path) as f:
+            for line in f:
+                columns = line.split()
+                if columns and not columns[0].startswith("#"):
+                    rows.append((float(columns[1]), float(columns[2])))
+
+    if not rows:
+        sys.exit(f"No data in {name} under {directory}")
+
+    return max(rows)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Checks the runs of Minkowski_single_precision_order_4.par"
+    )
+    parser.add_argument("single_1", help="output of the single precision run at resolution 1")
+    parser.add_argument("single_2", help="output of the single precision run at resolution 2")
+    parser.add_argument("double_1", help="output of the double precision run at resolution 1")
+    parser.add_argument("--order", type=float, default=4.0, help="expected convergence order")
+    parser.add_argument(
+        "--order-tolerance",
+        type=float,
+        default=0.5,
+        help="largest accepted deviation from the expected convergence order",
+    )
+    parser.add_argument(
+        "--agreement",
+        type=float,
+        default=1.0e-2,
+        help="largest accepted relative difference between single and double precision errors",
+    )
+    args = parser.parse_args()
+
+    passed = True
+
+    for variable in VARIABLES:
+        for reduction in REDUCTIONS:
+            t_s1, e_s1 = final_value(args.single_1, variable, reduction)
+            t_s2, e_s2 = final_value(args.single_2, variable, reduction)
+            t_d1, e_d1 = final_value(args.double_1, variable, reduction)
+
+            if not math.isclose(t_s1, t_s2) or not math.isclose(t_s1, t_d1):
+                sys.exit(f"{variable}.{reduction}: final times differ ({t_s1}, {t_s2}, {t_d1})")
+
+            order = math.log2(e_s1 / e_s2)
+            agreement = abs(e_s1 - e_d1) / e_d1
+
+            ok = abs(order - args.order) <= args.order_tolerance and agreement <= args.agreement
+            passed = passed and ok
+
+            print(
+                f"{variable}.{reduction} at t = {t_s1:g}: convergence order {order:.3f}, "
+                f"single vs double {agreement:.3e} {'OK' if ok else 'FAIL'}"
+            )
+
+    print("PASS" if passed else "FAIL")
+    return 0 if passed else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
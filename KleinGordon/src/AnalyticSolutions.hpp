@@ -0,0 +1,301 @@
+/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  AnalyticSolutions.hpp
+ *  Header only analytic solutions of the massless wave equation in
+ *  Minkowski spacetime, used for initial data and error estimates. The
+ *  point functions contain no branches, so that loops over i calling them
+ *  can be vectorized. Exported to other thorns as
+ *  KleinGordonAnalyticSolutions.hpp.
+ */
+
+#ifndef ANALYTIC_SOLUTIONS_HPP
+#define ANALYTIC_SOLUTIONS_HPP
+
+#include <array>
+#include <cmath>
+#include <utility>
+
+/* The point functions are always inlined, so that the loops calling them can be vectorized
+ * without the callers forcing inlining themselves */
+#if defined(__GNUC__)
+#define ANALYTIC_INLINE inline __attribute__((always_inline))
+#else
+#define ANALYTIC_INLINE inline
+#endif
+
+namespace analytic {
+
+/* A solution and its first derivatives at a point */
+template <typename T> struct wave_state {
+  T Phi, d_t_Phi, d_x_Phi, d_y_Phi, d_z_Phi;
+};
+
+/**************************************************
+ * Power series                                   *
+ *                                                *
+ * Both functions below are smooth at u = 0 but   *
+ * cancel catastrophically there when written in  *
+ * closed form. Each is evaluated both ways and   *
+ * the result selected, which compiles to a blend *
+ * instead of a branch.                           *
+ **************************************************/
+
+/* Number of terms kept in the series, enough for double precision when |u| < 1 */
+inline constexpr int series_terms = 20;
+
+/* Coefficients of (1 - e^-u) / u = sum_n (-u)^n / (n + 1)! */
+constexpr std::array<double, series_terms> one_minus_exp_coefficients() {
+  std::array<double, series_terms> c{};
+  double inverse_factorial = 1.0;
+
+  for (int n = 0; n < series_terms; n++) {
+    inverse_factorial /= n + 1;
+    c[n] = (n % 2 == 0 ? 1.0 : -1.0) * inverse_factorial;
+  }
+
+  return c;
+}
+
+/* Coefficients of (u (1 + e^-u) / 2 - (1 - e^-u)) / u^3
+ *   = sum_n (-1)^n (n + 1) u^n / (2 (n + 3)!) */
+constexpr std::array<double, series_terms> gaussian_gradient_coefficients() {
+  std::array<double, series_terms> c{};
+  double inverse_factorial = 1.0 / 6.0;
+
+  for (int n = 0; n < series_terms; n++) {
+    c[n] = (n % 2 == 0 ? 1.0 : -1.0) * (n + 1) * inverse_factorial / 2;
+    inverse_factorial /= n + 4;
+  }
+
+  return c;
+}
+
+/* sum_n c[n] u^n by Horner's rule, unrolled at compile time so that it adds no loop to the
+ * caller's */
+template <typename T, std::size_t N, std::size_t... n>
+ANALYTIC_INLINE constexpr T horner(T u, const std::array<double, N> &c,
+                                   std::index_sequence<n...>) {
+  T p = c[N - 1];
+  ((p = p * u + c[N - 2 - n]), ...);
+  return p;
+}
+
+template <typename T, std::size_t N>
+ANALYTIC_INLINE constexpr T horner(T u, const std::array<double, N> &c) {
+  return horner(u, c, std::make_index_sequence<N - 1>{});
+}
+
+/**************************************************
+ * Exact gaussian                                 *
+ *                                                *
+ * A (G(r - t) - G(r + t)) / r, with              *
+ * G(x) = exp(-x^2 / (2 sigma^2)), the spherical  *
+ * pulse that starts at rest with a vanishing     *
+ * field. With u = 2 r |t| / sigma^2 it is        *
+ * rewritten as                                   *
+ *   A G(r - |t|) 2 t / sigma^2 (1 - e^-u) / u,   *
+ * which is regular at r = 0 and never overflows, *
+ * and its derivatives follow in the same form.   *
+ **************************************************/
+template <typename T>
+ANALYTIC_INLINE wave_state<T> exact_gaussian(T t, T x, T y, T z, T A, T sigma) {
+  using std::abs;
+  using std::exp;
+  using std::sqrt;
+
+  constexpr auto phi_coefficients = one_minus_exp_coefficients();
+  constexpr auto psi_coefficients = gaussian_gradient_coefficients();
+
+  /* The solution is odd in t, so it is evaluated at |t| and the sign restored */
+  const T sign = t < 0 ? T(-1) : T(1);
+  const T ta = abs(t);
+
+  const T sigma2 = sigma * sigma;
+  const T r = sqrt(x * x + y * y + z * z);
+
+  const T q = 2 * ta / sigma2;
+  const T u = q * r;
+  const T e = exp(-u);
+
+  /* (1 - e^-u) / u and (u (1 + e^-u) / 2 - (1 - e^-u)) / u^3 */
+  const bool small = u < 1;
+  const T v = small ? T(1) : u;
+
+  const T phi = small ? horner(u, phi_coefficients) : (1 - e) / v;
+  const T psi = small ? horner(u, psi_coefficients) : (v * (1 + e) / 2 - (1 - e)) / (v * v * v);
+
+  const T a = r - ta;
+  const T E = A * exp(-a * a / (2 * sigma2));
+
+  /* d_r Phi / r, which is regular at r = 0 as well */
+  const T d_r_over_r = sign * E * (q * q * q * psi - q / sigma2 * phi);
+
+  return {sign * E * q * phi, E / sigma2 * (1 + e - q * ta * phi), d_r_over_r * x,
+          d_r_over_r * y, d_r_over_r * z};
+}
+
+/**************************************************
+ * Plane wave                                     *
+ *                                                *
+ * cos(2 pi (k.x - |k| t)), travelling along k.   *
+ **************************************************/
+template <typename T>
+ANALYTIC_INLINE wave_state<T> plane_wave(T t, T x, T y, T z, T kx, T ky, T kz) {
+  using std::cos;
+  using std::sin;
+  using std::sqrt;
+
+  const T two_pi = 2 * M_PI;
+  const T omega = sqrt(kx * kx + ky * ky + kz * kz);
+
+  const T w = two_pi * (kx * x + ky * y + kz * z - omega * t);
+  const T c = cos(w);
+  const T s = sin(w);
+
+  return {c, two_pi * omega * s, -two_pi * kx * s, -two_pi * ky * s, -two_pi * kz * s};
+}
+
+/**************************************************
+ * Standing wave                                  *
+ *                                                *
+ * A cos(2 pi |k| t) cos(2 pi kx x)               *
+ *   cos(2 pi ky y) cos(2 pi kz z).               *
+ **************************************************/
+template <typename T>
+ANALYTIC_INLINE wave_state<T> standing_wave(T t, T x, T y, T z, T A, T kx, T ky, T kz) {
+  using std::cos;
+  using std::sin;
+  using std::sqrt;
+
+  const T two_pi = 2 * M_PI;
+  const T omega = sqrt(kx * kx + ky * ky + kz * kz);
+
+  const T ct = cos(two_pi * omega * t), st = sin(two_pi * omega * t);
+  const T cx = cos(two_pi * kx * x), sx = sin(two_pi * kx * x);
+  const T cy = cos(two_pi * ky * y), sy = sin(two_pi * ky * y);
+  const T cz = cos(two_pi * kz * z), sz = sin(two_pi * kz * z);
+
+  return {A * ct * cx * cy * cz, -two_pi * omega * A * st * cx * cy * cz,
+          -two_pi * kx * A * ct * sx * cy * cz, -two_pi * ky * A * ct * cx * sy * cz,
+          -two_pi * kz * A * ct * cx * cy * sz};
+}
+
+/**************************************************
+ * Multipolar gaussian                            *
+ *                                                *
+ * A gaussian shell G(R - R0) times a series of   *
+ * real spherical harmonics. The radial and       *
+ * angular parts are kept apart, so that callers  *
+ * can reuse the angular factor along lines of    *
+ * constant direction.                            *
+ **************************************************/
+
+/* G(R - R0) and its derivative with respect to R */
+template <typename T> struct radial_profile {
+  T G, d_R_G;
+};
+
+template <typename T> ANALYTIC_INLINE radial_profile<T> gaussian_shell(T R, T R0, T sigma) {
+  using std::exp;
+
+  const T d = R - R0;
+  const T G = exp(-d * d / (2 * sigma * sigma));
+
+  return {G, -d / (sigma * sigma) * G};
+}
+
+/*
+ * All real spherical harmonics up to lmax at a given direction, with the conventions of
+ * GSL_SF_LEGENDRE_SPHARM and the Condon-Shortley phase: Y_lm = N_lm P_l^|m|(cos theta) cos(m phi)
+ * for m > 0 and Y_lm = N_lm P_l^|m|(cos theta) sin(|m| phi) for m < 0. Y[l * l + l + m] receives
+ * Y_lm and must hold (lmax + 1)^2 entries.
+ *
+ * The normalized associated Legendre functions are obtained with the three term recursion in l,
+ * starting from the diagonal m = l, and cos(m phi), sin(m phi) by repeated rotations.
+ */
+template <typename T> void real_spherical_harmonics(int lmax, T cos_theta, T phi, T *Y) {
+  using std::cos;
+  using std::sin;
+  using std::sqrt;
+
+  const T sin_theta = sqrt((1 - cos_theta) * (1 + cos_theta));
+
+  const T cos_phi = cos(phi);
+  const T sin_phi = sin(phi);
+
+  /* P_m^m, cos(m phi) and sin(m phi) for the current m */
+  T P_mm = sqrt(1 / (4 * T(M_PI)));
+  T cos_m_phi = 1;
+  T sin_m_phi = 0;
+
+  for (int m = 0; m <= lmax; m++) {
+    if (m > 0) {
+      P_mm *= -sqrt((2 * m + T(1)) / (2 * m)) * sin_theta;
+
+      const T cos_prev = cos_m_phi;
+      cos_m_phi = cos_prev * cos_phi - sin_m_phi * sin_phi;
+      sin_m_phi = sin_m_phi * cos_phi + cos_prev * sin_phi;
+    }
+
+    T P_l2 = 0;
+    T P_l1 = 0;
+
+    for (int l = m; l <= lmax; l++) {
+      T P_lm = 0;
+
+      if (l == m) {
+        P_lm = P_mm;
+      } else if (l == m + 1) {
+        P_lm = sqrt(2 * m + T(3)) * cos_theta * P_l1;
+      } else {
+        const T a = sqrt((4 * T(l) * l - 1) / T(l * l - m * m));
+        const T b = sqrt(T((l - 1) * (l - 1) - m * m) / (4 * T(l - 1) * (l - 1) - 1));
+        P_lm = a * (cos_theta * P_l1 - b * P_l2);
+      }
+
+      if (m == 0) {
+        Y[l * l + l] = P_lm;
+      } else {
+        Y[l * l + l + m] = P_lm * cos_m_phi;
+        Y[l * l + l - m] = P_lm * sin_m_phi;
+      }
+
+      P_l2 = P_l1;
+      P_l1 = P_lm;
+    }
+  }
+}
+
+/* sum_lm c_lm Y_lm, with the coefficients indexed as l * l + l + m and Y as scratch space */
+template <typename T>
+T multipole_series(int lmax, const T *coefficients, T cos_theta, T phi, T *Y) {
+  real_spherical_harmonics(lmax, cos_theta, phi, Y);
+
+  T sum = 0;
+
+  for (int n = 0; n < (lmax + 1) * (lmax + 1); n++)
+    sum += coefficients[n] * Y[n];
+
+  return sum;
+}
+
+} // namespace analytic
+
+#endif /* ANALYTIC_SOLUTIONS_HPP */
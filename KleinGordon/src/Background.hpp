@@ -0,0 +1,241 @@
+/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  Background.hpp
+ *  Metric derived quantities entering the right hand side of the
+ *  evolution equations.
+ */
+
+#ifndef BACKGROUND_HPP
+#define BACKGROUND_HPP
+
+#include "Christoffel.hpp"
+#include "Derivatives.hpp"
+#include "Tensor.hpp"
+
+#include "cctk_Arguments.h"
+
+namespace kg {
+
+/* Independent components of a symmetric 3-tensor */
+struct symmetric3 {
+  CCTK_REAL xx, xy, xz, yy, yz, zz;
+};
+
+/**************************************************
+ * Everything the K_Phi right hand side needs     *
+ * from the background space-time at one point.   *
+ * Gamma is the contracted Christoffel symbol     *
+ * Gamma^i = g^{jk} Gamma^i_{jk}.                 *
+ **************************************************/
+struct background {
+  symmetric3 ig;
+  CCTK_REAL K_trace;
+  global_gradient Gamma;
+  global_gradient d_alp;
+};
+
+/* Metric derivatives, one global gradient per metric component */
+struct metric_derivatives {
+  global_gradient gxx, gxy, gxz, gyy, gyz, gzz;
+};
+
+/**************************************************
+ * Ways of obtaining the contracted Christoffel   *
+ * symbols, selected by rhs_formulation.          *
+ *                                                *
+ * christoffel: all 18 Gamma^i_{jk} are computed  *
+ * and then contracted, in the generated          *
+ * contracted_christoffel. Kept as the reference. *
+ *                                                *
+ * contracted: Gamma^i = g^{il} v_l with          *
+ * v_l = g^{jk} (d_j g_{lk} - d_l g_{jk} / 2),    *
+ * which never forms the individual symbols.      *
+ **************************************************/
+enum class formulation { christoffel, contracted };
+
+template <formulation F>
+inline background compute_background(const symmetric3 &g, const symmetric3 &k,
+                                     const metric_derivatives &dg,
+                                     const global_gradient &d_alp) {
+  /* Inverse metric and trace of the extrinsic curvature */
+  const symmetric3 ig = tensor::inverse(g);
+  const CCTK_REAL KTraceL = tensor::contract(ig, k);
+
+  global_gradient Gamma;
+
+  if constexpr (F == formulation::christoffel) {
+    Gamma = contracted_christoffel(ig.xx, ig.xy, ig.xz, ig.yy, ig.yz, ig.zz, dg.gxx, dg.gxy,
+                                   dg.gxz, dg.gyy, dg.gyz, dg.gzz);
+  } else {
+    using tensor::get;
+
+    /* d_l g_{jk} at fixed l */
+    const auto d_g = [&](auto l) {
+      return symmetric3{get<l>(dg.gxx), get<l>(dg.gxy), get<l>(dg.gxz),
+                        get<l>(dg.gyy), get<l>(dg.gyz), get<l>(dg.gzz)};
+    };
+
+    /* v_l = g^{jk} d_j g_{lk} - g^{jk} d_l g_{jk} / 2 */
+    const auto v = [&](auto l) {
+      const CCTK_REAL div = tensor::sum<3>([&](auto j) {
+        return tensor::sum<3>([&](auto c) { return get<j, c>(ig) * get<j>(get<l, c>(dg)); });
+      });
+
+      return div - 0.5 * tensor::contract(ig, d_g(l));
+    };
+
+    Gamma = tensor::mul(ig, global_gradient{v(tensor::index<0>), v(tensor::index<1>),
+                                            v(tensor::index<2>)});
+  }
+
+  return {ig, KTraceL, Gamma, d_alp};
+}
+
+/**************************************************
+ * Patch-local form of the wave operator          *
+ *                                                *
+ * With d_i = J_{ai} d_a the right hand side of   *
+ * K_Phi becomes                                  *
+ *                                                *
+ * alp K K_Phi - G^{ab} d_ab Phi / 2              *
+ *   + u^a d_a Phi + alp m^2 Phi / 2              *
+ *   + beta^a d_a K_Phi                           *
+ *                                                *
+ * with                                           *
+ *                                                *
+ * G^{ab} = alp J_{ai} g^{ij} J_{bj},             *
+ * e^a = Gamma^i J_{ai} - g^{ij} dJ_{aij},        *
+ * u^a = (alp e^a - g^{ij} d_i alp J_{aj}) / 2,   *
+ * beta^a = J_{ai} beta^i.                        *
+ *                                                *
+ * For a static background on static patches all  *
+ * of these are computed once, and the RHS needs  *
+ * neither the Jacobians nor the metric.          *
+ **************************************************/
+struct local_symmetric3 {
+  CCTK_REAL aa, ab, ac, bb, bc, cc;
+};
+
+struct local_vector {
+  CCTK_REAL a, b, c;
+};
+
+struct local_operator {
+  local_symmetric3 G;
+  local_vector u;
+  local_vector beta;
+  CCTK_REAL alp_K;
+};
+
+/**************************************************
+ * Grid functions holding a cached static         *
+ * background, either in CCTK_REAL or, with       *
+ * single_precision_background, in CCTK_REAL4.    *
+ * Values are promoted to CCTK_REAL on load, so   *
+ * only the storage is rounded and all arithmetic *
+ * stays in double precision.                     *
+ **************************************************/
+template <typename real_t> struct background_storage {
+  real_t *ig_xx, *ig_xy, *ig_xz, *ig_yy, *ig_yz, *ig_zz;
+  real_t *K_trace;
+  real_t *Gamma_x, *Gamma_y, *Gamma_z;
+  real_t *d_alp_x, *d_alp_y, *d_alp_z;
+
+  background load(CCTK_INT ijk) const {
+    return {{ig_xx[ijk], ig_xy[ijk], ig_xz[ijk], ig_yy[ijk], ig_yz[ijk], ig_zz[ijk]},
+            K_trace[ijk],
+            {Gamma_x[ijk], Gamma_y[ijk], Gamma_z[ijk]},
+            {d_alp_x[ijk], d_alp_y[ijk], d_alp_z[ijk]}};
+  }
+
+  void store(CCTK_INT ijk, const background &bg) const {
+    ig_xx[ijk] = bg.ig.xx;
+    ig_xy[ijk] = bg.ig.xy;
+    ig_xz[ijk] = bg.ig.xz;
+    ig_yy[ijk] = bg.ig.yy;
+    ig_yz[ijk] = bg.ig.yz;
+    ig_zz[ijk] = bg.ig.zz;
+
+    K_trace[ijk] = bg.K_trace;
+
+    Gamma_x[ijk] = bg.Gamma.dx;
+    Gamma_y[ijk] = bg.Gamma.dy;
+    Gamma_z[ijk] = bg.Gamma.dz;
+
+    d_alp_x[ijk] = bg.d_alp.dx;
+    d_alp_y[ijk] = bg.d_alp.dy;
+    d_alp_z[ijk] = bg.d_alp.dz;
+  }
+};
+
+template <typename real_t> struct local_operator_storage {
+  real_t *lG_aa, *lG_ab, *lG_ac, *lG_bb, *lG_bc, *lG_cc;
+  real_t *lu_a, *lu_b, *lu_c;
+  real_t *lbeta_a, *lbeta_b, *lbeta_c;
+  real_t *alp_K_trace;
+
+  local_operator load(CCTK_INT ijk) const {
+    return {{lG_aa[ijk], lG_ab[ijk], lG_ac[ijk], lG_bb[ijk], lG_bc[ijk], lG_cc[ijk]},
+            {lu_a[ijk], lu_b[ijk], lu_c[ijk]},
+            {lbeta_a[ijk], lbeta_b[ijk], lbeta_c[ijk]},
+            alp_K_trace[ijk]};
+  }
+
+  void store(CCTK_INT ijk, const local_operator &op) const {
+    lG_aa[ijk] = op.G.aa;
+    lG_ab[ijk] = op.G.ab;
+    lG_ac[ijk] = op.G.ac;
+    lG_bb[ijk] = op.G.bb;
+    lG_bc[ijk] = op.G.bc;
+    lG_cc[ijk] = op.G.cc;
+
+    lu_a[ijk] = op.u.a;
+    lu_b[ijk] = op.u.b;
+    lu_c[ijk] = op.u.c;
+
+    lbeta_a[ijk] = op.beta.a;
+    lbeta_b[ijk] = op.beta.b;
+    lbeta_c[ijk] = op.beta.c;
+
+    alp_K_trace[ijk] = op.alp_K;
+  }
+};
+
+/***************************************************
+ * Checks whether the ADMBase variables on the     *
+ * current component changed by more than          *
+ * background_change_tolerance since they were     *
+ * last copied, so that background_group may be    *
+ * reused. If they did, they are copied again and  *
+ * the cached component is invalidated.            *
+ ***************************************************/
+bool background_is_frozen(CCTK_ARGUMENTS);
+
+/***************************************************
+ * Checks whether the contents of background_group *
+ * on the current component were computed since    *
+ * the background last changed. Returns false, and *
+ * marks them as filled, if they were not.         *
+ ***************************************************/
+bool background_is_current(CCTK_ARGUMENTS);
+
+} // namespace kg
+
+#endif /* BACKGROUND_HPP */
@@ -0,0 +1,142 @@
+/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  BackgroundCache.cpp
+ *  Tracks whether the contents of background_group are still valid, so
+ *  that they are recomputed only after the background changed. The ADMBase
+ *  variables the cache is computed from are compared with a copy kept for
+ *  each component, point by point and up to background_change_tolerance.
+ *  While the background evolves the RHS computes the metric derived
+ *  quantities point by point, and the copy is refreshed on the first RHS
+ *  evaluation of every MoL step. Once the background did not change over a
+ *  whole step, the cache is filled and reused.
+ */
+
+/*************************
+ * This thorn's includes *
+ *************************/
+#include "Background.hpp"
+#include "FusedTmunu.hpp"
+#include "KleinGordon.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <vector>
+
+namespace {
+
+/* The ADMBase variables background_group is computed from. The Jacobians only change with
+ * regridding and recovery, after which every copy is dropped */
+constexpr int num_inputs = 13;
+
+struct background_copy {
+  /* num_inputs consecutive copies of the component's ADMBase variables */
+  std::vector<CCTK_REAL> values;
+
+  /* Whether background_group was filled from values */
+  bool cached = false;
+};
+
+/* Keyed by the component's cache storage */
+std::map<const CCTK_REAL *, background_copy> background_copies;
+
+} // namespace
+
+bool kg::background_is_frozen(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS;
+  DECLARE_CCTK_PARAMETERS;
+
+  const CCTK_REAL *const inputs[num_inputs]
+      = {alp, gxx, gxy, gxz, gyy, gyz, gzz, kxx, kxy, kxz, kyy, kyz, kzz};
+
+  const std::size_t plane_size = std::size_t(cctk_ash[0]) * cctk_ash[1];
+  const std::size_t num_planes = cctk_ash[2];
+  const std::size_t num_points = plane_size * num_planes;
+
+  const auto [entry, inserted] = background_copies.try_emplace(ig_xx);
+  background_copy &copy = entry->second;
+
+  const auto differs = [&](CCTK_REAL now, CCTK_REAL before) {
+    return !(std::abs(now - before) <= background_change_tolerance * (1 + std::abs(before)));
+  };
+
+  /* An evolving background usually differs at the first points compared, so the comparison stops
+   * as soon as any plane of any variable changed */
+  std::atomic<bool> changed{inserted};
+
+#pragma omp parallel for collapse(2) schedule(static)
+  for (int v = 0; v < num_inputs; ++v) {
+    for (std::size_t k = 0; k < num_planes; ++k) {
+      if (changed.load(std::memory_order_relaxed))
+        continue;
+
+      const CCTK_REAL *const now = inputs[v] + k * plane_size;
+      const CCTK_REAL *const before = copy.values.data() + v * num_points + k * plane_size;
+
+      int plane_changed = 0;
+
+#pragma omp simd reduction(| : plane_changed)
+      for (std::size_t n = 0; n < plane_size; ++n)
+        plane_changed |= differs(now[n], before[n]);
+
+      if (plane_changed)
+        changed.store(true, std::memory_order_relaxed);
+    }
+  }
+
+  if (!changed)
+    return true;
+
+  /* The intermediate substeps are only compared, which is enough to detect a change within the
+   * step, so that an evolving background is copied once per step */
+  const CCTK_INT *const substep = kg::mol_intermediate_step(cctkGH);
+
+  if (!inserted && substep && *substep != MoL_Intermediate_Steps)
+    return false;
+
+  copy.values.resize(num_inputs * num_points);
+  copy.cached = false;
+
+#pragma omp parallel for collapse(2) schedule(static)
+  for (int v = 0; v < num_inputs; ++v) {
+    for (std::size_t k = 0; k < num_planes; ++k)
+      std::copy_n(inputs[v] + k * plane_size, plane_size,
+                  copy.values.data() + v * num_points + k * plane_size);
+  }
+
+  return false;
+}
+
+bool kg::background_is_current(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS;
+
+  background_copy &copy = background_copies[ig_xx];
+  const bool cached = copy.cached;
+  copy.cached = true;
+
+  return cached;
+}
+
+/* Storage freed by the regrid may be reused by other components, so the copies are dropped */
+extern "C" void KleinGordon_ClearBackgroundCache(CCTK_ARGUMENTS) {
+  background_copies.clear();
+}
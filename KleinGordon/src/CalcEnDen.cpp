@@ -0,0 +1,145 @@
+/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * CalcEnDen.cpp
+ * Compute the energy density of the wave equation and, with
+ * compute_total_energy, its integral over the proper volume of the grid.
+ */
+
+/*************************
+ * This thorn's includes *
+ *************************/
+#include "Derivatives.hpp"
+#include "Generated.hpp"
+#include "KleinGordon.h"
+#include "Tiling.hpp"
+#include "Integrals.hpp"
+#include "Reductions.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+/* Integrates the energy density over the proper volume when integrate is set, and stores it in
+ * rho_E when store is set */
+template <int order, bool store, bool integrate> struct enden_kernel {
+  static void compute(CCTK_ARGUMENTS);
+};
+
+template <int order> using enden_store = enden_kernel<order, true, false>;
+template <int order> using enden_integrate = enden_kernel<order, false, true>;
+template <int order> using enden_store_and_integrate = enden_kernel<order, true, true>;
+
+/* Each variant has its own cost, so each is autotuned separately */
+constexpr const char *enden_kernel_name(bool store, bool integrate) {
+  return !integrate ? "KleinGordon_CalcEnDen"
+                    : (store ? "KleinGordon_CalcEnDen_integrate" : "KleinGordon_CalcTotalEnergy");
+}
+
+template <int order, bool store, bool integrate>
+void enden_kernel<order, store, integrate>::compute(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS;
+  DECLARE_CCTK_PARAMETERS;
+
+  const kg::stencil<order> D(cctkGH);
+
+  const reduction::volume_weights vw
+      = integrate ? reduction::get_volume_weights(cctkGH) : reduction::volume_weights{};
+  const CCTK_REAL cell_volume
+      = CCTK_DELTA_SPACE(0) * CCTK_DELTA_SPACE(1) * CCTK_DELTA_SPACE(2);
+
+  /* Energy of each interior row, summed in a fixed order after the sweep so that the total does
+   * not depend on the tile shape nor on the threads that integrated the tiles */
+  const CCTK_INT jmin = cctk_nghostzones[1], kmin = cctk_nghostzones[2];
+  const CCTK_INT nj = std::max<CCTK_INT>(cctk_lsh[1] - 2 * jmin, 0);
+  const CCTK_INT nk = std::max<CCTK_INT>(cctk_lsh[2] - 2 * kmin, 0);
+
+  std::vector<CCTK_REAL> row_energy(integrate ? nj * nk : 0, 0.0);
+
+  kg::tiled_blocks(enden_kernel_name(store, integrate), cctkGH, tile_size_j, tile_size_k,
+                   [&](const kg::tile &t) {
+    for (CCTK_INT k = t.kmin; k < t.kmax; k++)
+      for (CCTK_INT j = t.jmin; j < t.jmax; j++) {
+        CCTK_REAL energy = 0.0;
+
+        for (CCTK_INT i = t.imin; i < t.imax; i++) {
+          const CCTK_INT ijk = CCTK_GFINDEX3D(cctkGH, i, j, k);
+
+          /* Assing ADM local variables */
+          const CCTK_REAL alpL = alp[ijk];
+
+          const CCTK_REAL betaxL = betax[ijk];
+          const CCTK_REAL betayL = betay[ijk];
+          const CCTK_REAL betazL = betaz[ijk];
+
+          const kg::symmetric3 h{gxx[ijk], gxy[ijk], gxz[ijk], gyy[ijk], gyz[ijk], gzz[ijk]};
+
+          /* Assing wave eq. local variables */
+          const CCTK_REAL PhiL = Phi[ijk];
+          const CCTK_REAL K_PhiL = K_Phi[ijk];
+
+          /* Assign Jacobians */
+          const kg::jacobian J{J11[ijk], J12[ijk], J13[ijk], J21[ijk], J22[ijk],
+                               J23[ijk], J31[ijk], J32[ijk], J33[ijk]};
+
+          const auto [deth, ih] = tensor::det_and_inverse(h);
+
+          const CCTK_REAL rho = kg::compute_energy_density(
+              alpL, betaxL, betayL, betazL, h, ih, PhiL, K_PhiL,
+              kg::to_global(D.gradient(Phi, ijk), J), field_mass);
+
+          if constexpr (store)
+            rho_E[ijk] = rho;
+
+          if constexpr (integrate)
+            energy += rho * std::sqrt(deth) * vw.volume_element(ijk, J);
+        }
+
+        if constexpr (integrate)
+          row_energy[(k - kmin) * nj + (j - jmin)] = energy;
+      }
+  });
+
+  if constexpr (integrate) {
+    CCTK_REAL energy = 0.0;
+
+    for (const CCTK_REAL e : row_energy)
+      energy += e;
+
+    kg::add_to_total_energy(cctkGH, energy * cell_volume);
+  }
+}
+
+} // namespace
+
+extern "C" void KleinGordon_CalcEnDen(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_PARAMETERS;
+
+  if (compute_total_energy)
+    kg::select_kernel<enden_store_and_integrate>(fd_order)(CCTK_PASS_CTOC);
+  else
+    kg::select_kernel<enden_store>(fd_order)(CCTK_PASS_CTOC);
+}
+
+extern "C" void KleinGordon_CalcTotalEnergy(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_PARAMETERS;
+  kg::select_kernel<enden_integrate>(fd_order)(CCTK_PASS_CTOC);
+}
@@ -0,0 +1,483 @@
+/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * CalcRHS.cpp
+ * Implements the evolution equations for the ADM-decomposed scalar wave
+ * equation as presented in Eqs. (A3c) and (A3d) of
+ * https://arxiv.org/pdf/1709.06118.pdf.
+ * The point-wise tensor algebra is generated by Notebooks/generate_kernels.py.
+ * The finite difference order is selected at runtime by fd_order. In static
+ * background evolutions the metric derived quantities are read from
+ * background_group instead of being recomputed. With detect_static_background
+ * the cache is used while the ADMBase variables do not change. The
+ * rhs_kernel_variant parameter selects between the scalar sweep and the
+ * vectorized one, and rhs_formulation how the contracted Christoffel symbols
+ * are obtained. With local_wave_operator the static background is cached as a
+ * wave operator in patch local coordinates, so that the RHS needs no Jacobians.
+ * With single_precision_background either static cache is stored in
+ * CCTK_REAL4 and promoted to CCTK_REAL when loaded. With fuse_Tmunu_with_RHS
+ * the field contribution to Tmunu is accumulated in the same point loop on
+ * the MoL substeps that follow an intermediate one, sharing the inverse
+ * metric, the gradient of Phi and the Jacobians.
+ */
+
+/*************************
+ * This thorn's includes *
+ *************************/
+#include "Background.hpp"
+#include "Derivatives.hpp"
+#include "FusedTmunu.hpp"
+#include "Generated.hpp"
+#include "KleinGordon.h"
+#include "Simd.hpp"
+#include "Tiling.hpp"
+
+#include <type_traits>
+
+namespace {
+
+using kg::formulation;
+
+/* Grid functions of the static background caches in the requested precision */
+template <typename real_t> kg::background_storage<real_t> background_storage(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS;
+
+  if constexpr (std::is_same_v<real_t, CCTK_REAL4>) {
+    return {ig_xx_single,   ig_xy_single,   ig_xz_single,   ig_yy_single,  ig_yz_single,
+            ig_zz_single,   K_trace_single, Gamma_x_single, Gamma_y_single, Gamma_z_single,
+            d_alp_x_single, d_alp_y_single, d_alp_z_single};
+  } else {
+    return {ig_xx,   ig_xy,   ig_xz,   ig_yy,   ig_yz,   ig_zz,  K_trace,
+            Gamma_x, Gamma_y, Gamma_z, d_alp_x, d_alp_y, d_alp_z};
+  }
+}
+
+template <typename real_t>
+kg::local_operator_storage<real_t> local_operator_storage(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS;
+
+  if constexpr (std::is_same_v<real_t, CCTK_REAL4>) {
+    return {lG_aa_single,   lG_ab_single,   lG_ac_single,   lG_bb_single,  lG_bc_single,
+            lG_cc_single,   lu_a_single,    lu_b_single,    lu_c_single,   lbeta_a_single,
+            lbeta_b_single, lbeta_c_single, alp_K_trace_single};
+  } else {
+    return {lG_aa, lG_ab, lG_ac,   lG_bb,   lG_bc,   lG_cc,      lu_a,
+            lu_b,  lu_c,  lbeta_a, lbeta_b, lbeta_c, alp_K_trace};
+  }
+}
+
+/* TmunuBase components the fused kernels add the field contribution to */
+struct tmunu_storage {
+  CCTK_REAL *tt, *tx, *ty, *tz, *xx, *xy, *xz, *yy, *yz, *zz;
+
+  void add(CCTK_INT ijk, const kg::stress_energy_tensor &T) const {
+    tt[ijk] += T.tt;
+    tx[ijk] += T.tx;
+    ty[ijk] += T.ty;
+    tz[ijk] += T.tz;
+    xx[ijk] += T.xx;
+    xy[ijk] += T.xy;
+    xz[ijk] += T.xz;
+    yy[ijk] += T.yy;
+    yz[ijk] += T.yz;
+    zz[ijk] += T.zz;
+  }
+};
+
+tmunu_storage stress_energy_storage(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS;
+
+  return {eTtt, eTtx, eTty, eTtz, eTxx, eTxy, eTxz, eTyy, eTyz, eTzz};
+}
+
+/* Sweeps the interior column by column, rolling the first derivatives of Phi along k. The
+ * columns span the whole k extent, so that the planes preceding the first one are only
+ * computed once per column */
+template <int order, typename Point>
+void rhs_sweep(CCTK_ARGUMENTS, const kg::stencil<order> &D, const Point &point) {
+  DECLARE_CCTK_ARGUMENTS;
+  DECLARE_CCTK_PARAMETERS;
+
+  const bool vectorize = CCTK_EQUALS(rhs_kernel_variant, "simd");
+
+  kg::tiled_columns("KleinGordon_RHS", cctkGH, tile_size_j, [&](const kg::tile &t) {
+    /* First derivatives of Phi on the planes around k, feeding its mixed derivatives */
+    kg::rolling_derivatives<order> Phi_planes(D, Phi, t.imin, t.imax, t.jmin, t.jmax, t.kmin);
+
+    for (CCTK_INT k = t.kmin; k < t.kmax; k++) {
+      Phi_planes.advance(k);
+
+      for (CCTK_INT j = t.jmin; j < t.jmax; j++) {
+        /* The scalar sweep is kept as the reference implementation */
+        if (vectorize) {
+          kg::simd_row(t.imin, t.imax, [&](CCTK_INT i) { point(i, j, k, Phi_planes); });
+        } else {
+          for (CCTK_INT i = t.imin; i < t.imax; i++)
+            point(i, j, k, Phi_planes);
+        }
+      }
+    }
+  });
+}
+
+/* F is only used when the background is not static, real_t only when it is. With tmunu set
+ * the field contribution to the stress energy tensor is accumulated as well */
+template <int order, bool static_bg, formulation F = formulation::christoffel,
+          typename real_t = CCTK_REAL, bool tmunu = false>
+struct rhs_kernel {
+  static void compute(CCTK_ARGUMENTS);
+};
+
+template <int order> using rhs_christoffel = rhs_kernel<order, false, formulation::christoffel>;
+template <int order> using rhs_contracted = rhs_kernel<order, false, formulation::contracted>;
+template <int order> using rhs_static = rhs_kernel<order, true>;
+
+template <int order>
+using rhs_static_single = rhs_kernel<order, true, formulation::christoffel, CCTK_REAL4>;
+
+template <int order>
+using rhs_christoffel_tmunu
+    = rhs_kernel<order, false, formulation::christoffel, CCTK_REAL, true>;
+
+template <int order>
+using rhs_contracted_tmunu = rhs_kernel<order, false, formulation::contracted, CCTK_REAL, true>;
+
+template <int order>
+using rhs_static_tmunu = rhs_kernel<order, true, formulation::christoffel, CCTK_REAL, true>;
+
+template <int order>
+using rhs_static_single_tmunu
+    = rhs_kernel<order, true, formulation::christoffel, CCTK_REAL4, true>;
+
+template <int order, bool static_bg, formulation F, typename real_t, bool tmunu>
+void rhs_kernel<order, static_bg, F, real_t, tmunu>::compute(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS;
+  DECLARE_CCTK_PARAMETERS;
+
+  const kg::stencil<order> D(cctkGH);
+  const auto cache = background_storage<real_t>(CCTK_PASS_CTOC);
+  const auto Tmunu = stress_energy_storage(CCTK_PASS_CTOC);
+
+  /* cctk_bbox elements 4 and 5
+   * 4 - non zero tells i need to apply bnd condition at the lower end
+   * 5 - non zero tells i need to apply bnd condition at the upper end
+   * Query cctk_bbox for the loop limits before looping and apply 2nd order stencil accordingly
+   *
+   * This is only required for the z direction (thornburg radial) including one sided stencil,
+     other directions must be centered
+   *
+   * This is only true in Thornburg coordinates.
+   *
+   * kmin = cctk_bbox[4] ? 0 : gz;
+   * kmax = cctk_lsh[2] - (cctk_bbox[5] ? 0 : gz);
+   * if (k==0) one-sided (right bias)
+   * else if (k==cctk_lsh[2]-1) one-sided (the other way)
+   * else centred
+   *
+   * if (k==0) df = (f[k+1] - f[k]) / h;
+   * else if (k==lsh[2]-1) df = (f[k] - f[k-1]) / h;
+   * else df = (f(k+1) - f(k-1) / (2*h);
+   */
+  const auto point = [&](CCTK_INT i, CCTK_INT j, CCTK_INT k,
+                         const kg::rolling_derivatives<order> &Phi_planes) {
+    const CCTK_INT ijk = CCTK_GFINDEX3D(cctkGH, i, j, k);
+
+    /* Assing ADM local variables */
+    const CCTK_REAL alpL = alp[ijk];
+
+    const CCTK_REAL betaxL = betax[ijk];
+    const CCTK_REAL betayL = betay[ijk];
+    const CCTK_REAL betazL = betaz[ijk];
+
+    /* Assing wave eq. local variables */
+    const CCTK_REAL PhiL = Phi[ijk];
+    const CCTK_REAL K_PhiL = K_Phi[ijk];
+
+    /* Assign Jacobians */
+    const kg::jacobian J{J11[ijk], J12[ijk], J13[ijk], J21[ijk], J22[ijk],
+                         J23[ijk], J31[ijk], J32[ijk], J33[ijk]};
+
+    /* Assign jacobian derivatives */
+    const kg::jacobian_derivatives dJ{
+        dJ111[ijk], dJ112[ijk], dJ113[ijk], dJ122[ijk], dJ123[ijk], dJ133[ijk],
+        dJ211[ijk], dJ212[ijk], dJ213[ijk], dJ222[ijk], dJ223[ijk], dJ233[ijk],
+        dJ311[ijk], dJ312[ijk], dJ313[ijk], dJ322[ijk], dJ323[ijk], dJ333[ijk]};
+
+    /* Background quantities */
+    kg::background bg;
+
+    if constexpr (static_bg) {
+      bg = cache.load(ijk);
+    } else {
+      const kg::symmetric3 g{gxx[ijk], gxy[ijk], gxz[ijk], gyy[ijk], gyz[ijk], gzz[ijk]};
+      const kg::symmetric3 kij{kxx[ijk], kxy[ijk], kxz[ijk], kyy[ijk], kyz[ijk], kzz[ijk]};
+
+      const kg::metric_derivatives dg{
+          kg::to_global(D.gradient(gxx, ijk), J), kg::to_global(D.gradient(gxy, ijk), J),
+          kg::to_global(D.gradient(gxz, ijk), J), kg::to_global(D.gradient(gyy, ijk), J),
+          kg::to_global(D.gradient(gyz, ijk), J), kg::to_global(D.gradient(gzz, ijk), J)};
+
+      bg = kg::compute_background<F>(g, kij, dg, kg::to_global(D.gradient(alp, ijk), J));
+    }
+
+    /* Derivatives of Phi and K_Phi, each local stencil evaluated once per point */
+    const kg::local_derivatives l_Phi = Phi_planes.derivatives(i, j, ijk);
+
+    const kg::global_gradient d_Phi = kg::to_global(l_Phi.d, J);
+    const kg::global_hessian dd_Phi = kg::to_global(l_Phi, J, dJ);
+    const kg::global_gradient d_K_Phi = kg::to_global(D.gradient(K_Phi, ijk), J);
+
+    /* Phi_rhs */
+    Phi_rhs[ijk]
+        = -2.0 * alpL * K_PhiL + betaxL * d_Phi.dx + betayL * d_Phi.dy + betazL * d_Phi.dz;
+
+    /* K_Phi_rhs */
+    K_Phi_rhs[ijk] = kg::K_Phi_rhs_point(bg, alpL, betaxL, betayL, betazL, PhiL, K_PhiL,
+                                         d_Phi, dd_Phi, d_K_Phi, field_mass);
+
+    /* The inverse metric is taken from the background, so that it is not inverted twice */
+    if constexpr (tmunu) {
+      const kg::symmetric3 h{gxx[ijk], gxy[ijk], gxz[ijk], gyy[ijk], gyz[ijk], gzz[ijk]};
+
+      Tmunu.add(ijk, kg::compute_stress_energy(alpL, betaxL, betayL, betazL, h, bg.ig, PhiL,
+                                               K_PhiL, d_Phi, field_mass));
+    }
+  };
+
+  rhs_sweep<order>(CCTK_PASS_CTOC, D, point);
+}
+
+template <int order, typename real_t = CCTK_REAL, bool tmunu = false> struct rhs_local {
+  static void compute(CCTK_ARGUMENTS);
+};
+
+template <int order> using rhs_local_single = rhs_local<order, CCTK_REAL4>;
+template <int order> using rhs_local_tmunu = rhs_local<order, CCTK_REAL, true>;
+template <int order> using rhs_local_single_tmunu = rhs_local<order, CCTK_REAL4, true>;
+
+template <int order, typename real_t, bool tmunu>
+void rhs_local<order, real_t, tmunu>::compute(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS;
+  DECLARE_CCTK_PARAMETERS;
+
+  const kg::stencil<order> D(cctkGH);
+  const auto cache = local_operator_storage<real_t>(CCTK_PASS_CTOC);
+  const auto Tmunu = stress_energy_storage(CCTK_PASS_CTOC);
+
+  const auto point = [&](CCTK_INT i, CCTK_INT j, CCTK_INT k,
+                         const kg::rolling_derivatives<order> &Phi_planes) {
+    const CCTK_INT ijk = CCTK_GFINDEX3D(cctkGH, i, j, k);
+
+    const CCTK_REAL alpL = alp[ijk];
+    const CCTK_REAL PhiL = Phi[ijk];
+    const CCTK_REAL K_PhiL = K_Phi[ijk];
+
+    const kg::local_operator op = cache.load(ijk);
+
+    /* Derivatives of Phi and K_Phi are used in patch coordinates directly */
+    const kg::local_derivatives l_Phi = Phi_planes.derivatives(i, j, ijk);
+    const kg::local_gradient l_K_Phi = D.gradient(K_Phi, ijk);
+
+    /* Phi_rhs */
+    Phi_rhs[ijk] = -2.0 * alpL * K_PhiL + op.beta.a * l_Phi.d.da + op.beta.b * l_Phi.d.db
+                   + op.beta.c * l_Phi.d.dc;
+
+    /* K_Phi_rhs */
+    K_Phi_rhs[ijk] = kg::K_Phi_rhs_local(op, alpL, PhiL, K_PhiL, l_Phi, l_K_Phi, field_mass);
+
+    /* The local operator holds no metric, so only the stencils of Phi are shared */
+    if constexpr (tmunu) {
+      const kg::jacobian J{J11[ijk], J12[ijk], J13[ijk], J21[ijk], J22[ijk],
+                           J23[ijk], J31[ijk], J32[ijk], J33[ijk]};
+
+      const kg::symmetric3 h{gxx[ijk], gxy[ijk], gxz[ijk], gyy[ijk], gyz[ijk], gzz[ijk]};
+
+      Tmunu.add(ijk, kg::compute_stress_energy(alpL, betax[ijk], betay[ijk], betaz[ijk], h,
+                                               tensor::inverse(h), PhiL, K_PhiL,
+                                               kg::to_global(l_Phi.d, J), field_mass));
+    }
+  };
+
+  rhs_sweep<order>(CCTK_PASS_CTOC, D, point);
+}
+
+/* With local set, the background is stored as a patch local operator in local_operator_group */
+template <int order, formulation F, bool local = false, typename real_t = CCTK_REAL>
+struct background_kernel {
+  static void compute(CCTK_ARGUMENTS);
+};
+
+template <int order>
+using background_christoffel = background_kernel<order, formulation::christoffel>;
+
+template <int order>
+using background_contracted = background_kernel<order, formulation::contracted>;
+
+template <int order>
+using local_operator_christoffel = background_kernel<order, formulation::christoffel, true>;
+
+template <int order>
+using local_operator_contracted = background_kernel<order, formulation::contracted, true>;
+
+template <int order>
+using background_christoffel_single
+    = background_kernel<order, formulation::christoffel, false, CCTK_REAL4>;
+
+template <int order>
+using background_contracted_single
+    = background_kernel<order, formulation::contracted, false, CCTK_REAL4>;
+
+template <int order>
+using local_operator_christoffel_single
+    = background_kernel<order, formulation::christoffel, true, CCTK_REAL4>;
+
+template <int order>
+using local_operator_contracted_single
+    = background_kernel<order, formulation::contracted, true, CCTK_REAL4>;
+
+template <int order, formulation F, bool local, typename real_t>
+void background_kernel<order, F, local, real_t>::compute(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS;
+  DECLARE_CCTK_PARAMETERS;
+
+  const kg::stencil<order> D(cctkGH);
+  const auto background_cache = background_storage<real_t>(CCTK_PASS_CTOC);
+  const auto local_operator_cache = local_operator_storage<real_t>(CCTK_PASS_CTOC);
+
+  kg::tiled_loop("KleinGordon_CalcBackground", cctkGH, tile_size_j, tile_size_k,
+                 [&](CCTK_INT i, CCTK_INT j, CCTK_INT k) {
+    const CCTK_INT ijk = CCTK_GFINDEX3D(cctkGH, i, j, k);
+
+    const kg::jacobian J{J11[ijk], J12[ijk], J13[ijk], J21[ijk], J22[ijk],
+                         J23[ijk], J31[ijk], J32[ijk], J33[ijk]};
+
+    const kg::symmetric3 g{gxx[ijk], gxy[ijk], gxz[ijk], gyy[ijk], gyz[ijk], gzz[ijk]};
+    const kg::symmetric3 kij{kxx[ijk], kxy[ijk], kxz[ijk], kyy[ijk], kyz[ijk], kzz[ijk]};
+
+    const kg::metric_derivatives dg{
+        kg::to_global(D.gradient(gxx, ijk), J), kg::to_global(D.gradient(gxy, ijk), J),
+        kg::to_global(D.gradient(gxz, ijk), J), kg::to_global(D.gradient(gyy, ijk), J),
+        kg::to_global(D.gradient(gyz, ijk), J), kg::to_global(D.gradient(gzz, ijk), J)};
+
+    const kg::background bg
+        = kg::compute_background<F>(g, kij, dg, kg::to_global(D.gradient(alp, ijk), J));
+
+    if constexpr (local) {
+      const kg::jacobian_derivatives dJ{
+          dJ111[ijk], dJ112[ijk], dJ113[ijk], dJ122[ijk], dJ123[ijk], dJ133[ijk],
+          dJ211[ijk], dJ212[ijk], dJ213[ijk], dJ222[ijk], dJ223[ijk], dJ233[ijk],
+          dJ311[ijk], dJ312[ijk], dJ313[ijk], dJ322[ijk], dJ323[ijk], dJ333[ijk]};
+
+      const kg::local_operator op
+          = kg::to_local(bg, alp[ijk], {betax[ijk], betay[ijk], betaz[ijk]}, J, dJ);
+
+      local_operator_cache.store(ijk, op);
+    } else {
+      background_cache.store(ijk, bg);
+    }
+  });
+}
+
+/* The background cache of detect_static_background is always kept in double precision */
+void calc_background(CCTK_ARGUMENTS, bool single) {
+  DECLARE_CCTK_PARAMETERS;
+
+  if (single && CCTK_EQUALS(rhs_formulation, "contracted"))
+    kg::select_kernel<background_contracted_single>(fd_order)(CCTK_PASS_CTOC);
+  else if (single)
+    kg::select_kernel<background_christoffel_single>(fd_order)(CCTK_PASS_CTOC);
+  else if (CCTK_EQUALS(rhs_formulation, "contracted"))
+    kg::select_kernel<background_contracted>(fd_order)(CCTK_PASS_CTOC);
+  else
+    kg::select_kernel<background_christoffel>(fd_order)(CCTK_PASS_CTOC);
+}
+
+void calc_local_operator(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_PARAMETERS;
+
+  if (single_precision_background && CCTK_EQUALS(rhs_formulation, "contracted"))
+    kg::select_kernel<local_operator_contracted_single>(fd_order)(CCTK_PASS_CTOC);
+  else if (single_precision_background)
+    kg::select_kernel<local_operator_christoffel_single>(fd_order)(CCTK_PASS_CTOC);
+  else if (CCTK_EQUALS(rhs_formulation, "contracted"))
+    kg::select_kernel<local_operator_contracted>(fd_order)(CCTK_PASS_CTOC);
+  else
+    kg::select_kernel<local_operator_christoffel>(fd_order)(CCTK_PASS_CTOC);
+}
+
+/* Same dispatch as KleinGordon_RHS, with the fused kernels */
+void rhs_with_tmunu(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_PARAMETERS;
+
+  if (static_background && local_wave_operator && single_precision_background) {
+    kg::select_kernel<rhs_local_single_tmunu>(fd_order)(CCTK_PASS_CTOC);
+  } else if (static_background && local_wave_operator) {
+    kg::select_kernel<rhs_local_tmunu>(fd_order)(CCTK_PASS_CTOC);
+  } else if (static_background && single_precision_background) {
+    kg::select_kernel<rhs_static_single_tmunu>(fd_order)(CCTK_PASS_CTOC);
+  } else if (static_background) {
+    kg::select_kernel<rhs_static_tmunu>(fd_order)(CCTK_PASS_CTOC);
+  } else if (detect_static_background && kg::background_is_frozen(CCTK_PASS_CTOC)) {
+    if (!kg::background_is_current(CCTK_PASS_CTOC))
+      calc_background(CCTK_PASS_CTOC, false);
+
+    kg::select_kernel<rhs_static_tmunu>(fd_order)(CCTK_PASS_CTOC);
+  } else if (CCTK_EQUALS(rhs_formulation, "contracted")) {
+    kg::select_kernel<rhs_contracted_tmunu>(fd_order)(CCTK_PASS_CTOC);
+  } else {
+    kg::select_kernel<rhs_christoffel_tmunu>(fd_order)(CCTK_PASS_CTOC);
+  }
+}
+
+} // namespace
+
+extern "C" void KleinGordon_RHS(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_PARAMETERS;
+
+  if (kg::rhs_adds_tmunu(CCTK_PASS_CTOC)) {
+    rhs_with_tmunu(CCTK_PASS_CTOC);
+  } else if (static_background && local_wave_operator && single_precision_background) {
+    kg::select_kernel<rhs_local_single>(fd_order)(CCTK_PASS_CTOC);
+  } else if (static_background && local_wave_operator) {
+    kg::select_kernel<rhs_local>(fd_order)(CCTK_PASS_CTOC);
+  } else if (static_background && single_precision_background) {
+    kg::select_kernel<rhs_static_single>(fd_order)(CCTK_PASS_CTOC);
+  } else if (static_background) {
+    kg::select_kernel<rhs_static>(fd_order)(CCTK_PASS_CTOC);
+  } else if (detect_static_background && kg::background_is_frozen(CCTK_PASS_CTOC)) {
+    if (!kg::background_is_current(CCTK_PASS_CTOC))
+      calc_background(CCTK_PASS_CTOC, false);
+
+    kg::select_kernel<rhs_static>(fd_order)(CCTK_PASS_CTOC);
+  } else if (CCTK_EQUALS(rhs_formulation, "contracted")) {
+    kg::select_kernel<rhs_contracted>(fd_order)(CCTK_PASS_CTOC);
+  } else {
+    kg::select_kernel<rhs_christoffel>(fd_order)(CCTK_PASS_CTOC);
+  }
+}
+
+extern "C" void KleinGordon_CalcBackground(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_PARAMETERS;
+
+  calc_background(CCTK_PASS_CTOC, single_precision_background);
+}
+
+extern "C" void KleinGordon_CalcLocalOperator(CCTK_ARGUMENTS) {
+  calc_local_operator(CCTK_PASS_CTOC);
+}
@@ -0,0 +1,94 @@
+/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * CalcTmunu.cpp
+ * Compute the energy momentum tensor of the wave equation. With
+ * fuse_Tmunu_with_RHS the pass is skipped after the intermediate MoL
+ * substeps, where the RHS adds the contribution.
+ */
+
+/*************************
+ * This thorn's includes *
+ *************************/
+#include "Derivatives.hpp"
+#include "FusedTmunu.hpp"
+#include "Generated.hpp"
+#include "KleinGordon.h"
+#include "Tiling.hpp"
+
+namespace {
+
+template <int order> struct tmunu_kernel {
+  static void compute(CCTK_ARGUMENTS);
+};
+
+template <int order> void tmunu_kernel<order>::compute(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS;
+  DECLARE_CCTK_PARAMETERS;
+
+  const kg::stencil<order> D(cctkGH);
+
+  kg::tiled_loop("KleinGordon_CalcTmunu", cctkGH, tile_size_j, tile_size_k,
+                 [&](CCTK_INT i, CCTK_INT j, CCTK_INT k) {
+    const CCTK_INT ijk = CCTK_GFINDEX3D(cctkGH, i, j, k);
+
+    /* Assing ADM local variables */
+    const CCTK_REAL alpL = alp[ijk];
+
+    const CCTK_REAL betaxL = betax[ijk];
+    const CCTK_REAL betayL = betay[ijk];
+    const CCTK_REAL betazL = betaz[ijk];
+
+    const kg::symmetric3 h{gxx[ijk], gxy[ijk], gxz[ijk], gyy[ijk], gyz[ijk], gzz[ijk]};
+
+    /* Assing wave eq. local variables */
+    const CCTK_REAL PhiL = Phi[ijk];
+    const CCTK_REAL K_PhiL = K_Phi[ijk];
+
+    /* Assign Jacobians */
+    const kg::jacobian J{J11[ijk], J12[ijk], J13[ijk], J21[ijk], J22[ijk],
+                         J23[ijk], J31[ijk], J32[ijk], J33[ijk]};
+
+    const kg::stress_energy_tensor T
+        = kg::compute_stress_energy(alpL, betaxL, betayL, betazL, h, tensor::inverse(h), PhiL,
+                                    K_PhiL, kg::to_global(D.gradient(Phi, ijk), J), field_mass);
+
+    eTtt[ijk] += T.tt;
+    eTtx[ijk] += T.tx;
+    eTty[ijk] += T.ty;
+    eTtz[ijk] += T.tz;
+    eTxx[ijk] += T.xx;
+    eTxy[ijk] += T.xy;
+    eTxz[ijk] += T.xz;
+    eTyy[ijk] += T.yy;
+    eTyz[ijk] += T.yz;
+    eTzz[ijk] += T.zz;
+  });
+}
+
+} // namespace
+
+extern "C" void KleinGordon_CalcTmunu(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_PARAMETERS;
+
+  if (!kg::calc_tmunu_adds_tmunu(CCTK_PASS_CTOC))
+    return;
+
+  kg::select_kernel<tmunu_kernel>(fd_order)(CCTK_PASS_CTOC);
+}
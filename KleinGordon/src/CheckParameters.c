@@ -54,6 +54,40 @@ void KleinGordon_CheckParameters(CCTK_ARGUMENTS) {
   }
   }
 
+  if (static_background && !CCTK_Equals(evolution_method, "static")) {
+    CCTK_PARAMWARN("A static background was requested but ADMBase::evolution_method is not "
+                   "\"static\". The cached background quantities would become stale.");
+  }
+
+  if (static_background && detect_static_background)
+    CCTK_INFO("Both static_background and detect_static_background are set. The background "
+              "will be treated as static and no change detection will be performed.");
+
+  if (local_wave_operator && !static_background)
+    CCTK_PARAMWARN("local_wave_operator requires static_background to be set.");
+
+  if (single_precision_background && !static_background)
+    CCTK_PARAMWARN("single_precision_background requires static_background to be set. The "
+                   "cache of detect_static_background is always kept in double precision.");
+
+  if (fuse_Tmunu_with_RHS && !(compute_Tmunu && stress_energy_at_RHS))
+    CCTK_PARAMWARN("fuse_Tmunu_with_RHS requires compute_Tmunu and "
+                   "TmunuBase::stress_energy_at_RHS to be set.");
+
+  /* The RHS group is only ordered before McLachlan's RHS, so any other spacetime evolution may
+   * read Tmunu before the field contribution is added */
+  if (fuse_Tmunu_with_RHS && !CCTK_IsThornActive("ML_BSSN"))
+    CCTK_ERROR("fuse_Tmunu_with_RHS requires the spacetime to be evolved by ML_BSSN, which is "
+               "not active. Other evolution thorns would read Tmunu before the RHS of this "
+               "thorn adds the field contribution.");
+
+  if (fuse_Tmunu_with_RHS && test_multipatch)
+    CCTK_PARAMWARN("fuse_Tmunu_with_RHS can not be used with test_multipatch, which schedules "
+                   "the RHS outside of MoL.");
+
+  if (CCTK_Equals(initial_data, "from_file") && CCTK_Equals(initial_data_file, ""))
+    CCTK_PARAMWARN("\"from_file\" initial data was requested but initial_data_file is empty.");
+
   if (compute_error && !CCTK_Equals(initial_data, "exact_gaussian")) {
     CCTK_PARAMWARN("Error computing was requested with an initial condition other than "
                    "\"exact_gaussian\". The error estimate is only significant when "
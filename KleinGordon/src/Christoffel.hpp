@@ -0,0 +1,111 @@
+/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  Christoffel.hpp
+ *  Contracted Christoffel symbols of the christoffel formulation of
+ *  the background, see compute_background in Background.hpp.
+ *
+ *  Generated by Notebooks/generate_kernels.py. Do not edit by hand.
+ */
+
+#ifndef CHRISTOFFEL_HPP
+#define CHRISTOFFEL_HPP
+
+#include "Derivatives.hpp"
+
+namespace kg {
+
+/*
+ * Contracted Christoffel symbols Gamma^i = g^{jk} Gamma^i_{jk}, with all 18
+ * Gamma^i_{jk} formed first.
+ */
+inline global_gradient contracted_christoffel(CCTK_REAL igxxL, CCTK_REAL igxyL, CCTK_REAL igxzL,
+                                              CCTK_REAL igyyL, CCTK_REAL igyzL, CCTK_REAL igzzL,
+                                              const global_gradient &d_gxx,
+                                              const global_gradient &d_gxy,
+                                              const global_gradient &d_gxz,
+                                              const global_gradient &d_gyy,
+                                              const global_gradient &d_gyz,
+                                              const global_gradient &d_gzz) {
+  const CCTK_REAL d_x_gxx = d_gxx.dx;
+  const CCTK_REAL d_y_gxx = d_gxx.dy;
+  const CCTK_REAL d_z_gxx = d_gxx.dz;
+  const CCTK_REAL d_x_gxy = d_gxy.dx;
+  const CCTK_REAL d_y_gxy = d_gxy.dy;
+  const CCTK_REAL d_z_gxy = d_gxy.dz;
+  const CCTK_REAL d_x_gxz = d_gxz.dx;
+  const CCTK_REAL d_y_gxz = d_gxz.dy;
+  const CCTK_REAL d_z_gxz = d_gxz.dz;
+  const CCTK_REAL d_x_gyy = d_gyy.dx;
+  const CCTK_REAL d_y_gyy = d_gyy.dy;
+  const CCTK_REAL d_z_gyy = d_gyy.dz;
+  const CCTK_REAL d_x_gyz = d_gyz.dx;
+  const CCTK_REAL d_y_gyz = d_gyz.dy;
+  const CCTK_REAL d_z_gyz = d_gyz.dz;
+  const CCTK_REAL d_x_gzz = d_gzz.dx;
+  const CCTK_REAL d_y_gzz = d_gzz.dy;
+  const CCTK_REAL d_z_gzz = d_gzz.dz;
+
+  const CCTK_REAL t0 = 2 * d_x_gxy - d_y_gxx;
+  const CCTK_REAL t1 = 2 * d_x_gxz - d_z_gxx;
+  const CCTK_REAL t2 = d_x_gyz + d_y_gxz - d_z_gxy;
+  const CCTK_REAL t3 = d_x_gyz - d_y_gxz + d_z_gxy;
+  const CCTK_REAL t4 = 2 * d_y_gyz - d_z_gyy;
+  const CCTK_REAL t5 = d_x_gyy - 2 * d_y_gxy;
+  const CCTK_REAL t6 = -d_x_gyz + d_y_gxz + d_z_gxy;
+  const CCTK_REAL t7 = d_x_gzz - 2 * d_z_gxz;
+  const CCTK_REAL t8 = d_y_gzz - 2 * d_z_gyz;
+  const CCTK_REAL t9 = 2 * igxyL;
+  const CCTK_REAL t10 = 2 * igxzL;
+  const CCTK_REAL t11 = 2 * igyzL;
+  const CCTK_REAL Gamma_xxx = 0.5 * d_x_gxx * igxxL + 0.5 * igxyL * t0 + 0.5 * igxzL * t1;
+  const CCTK_REAL Gamma_xxy = 0.5 * d_x_gyy * igxyL + 0.5 * d_y_gxx * igxxL + 0.5 * igxzL * t2;
+  const CCTK_REAL Gamma_xxz = 0.5 * d_x_gzz * igxzL + 0.5 * d_z_gxx * igxxL + 0.5 * igxyL * t3;
+  const CCTK_REAL Gamma_xyy = 0.5 * d_y_gyy * igxyL - 0.5 * igxxL * t5 + 0.5 * igxzL * t4;
+  const CCTK_REAL Gamma_xyz = 0.5 * d_y_gzz * igxzL + 0.5 * d_z_gyy * igxyL + 0.5 * igxxL * t6;
+  const CCTK_REAL Gamma_xzz = 0.5 * d_z_gzz * igxzL - 0.5 * igxxL * t7 - 0.5 * igxyL * t8;
+  const CCTK_REAL Gamma_yxx = 0.5 * d_x_gxx * igxyL + 0.5 * igyyL * t0 + 0.5 * igyzL * t1;
+  const CCTK_REAL Gamma_yxy = 0.5 * d_x_gyy * igyyL + 0.5 * d_y_gxx * igxyL + 0.5 * igyzL * t2;
+  const CCTK_REAL Gamma_yxz = 0.5 * d_x_gzz * igyzL + 0.5 * d_z_gxx * igxyL + 0.5 * igyyL * t3;
+  const CCTK_REAL Gamma_yyy = 0.5 * d_y_gyy * igyyL - 0.5 * igxyL * t5 + 0.5 * igyzL * t4;
+  const CCTK_REAL Gamma_yyz = 0.5 * d_y_gzz * igyzL + 0.5 * d_z_gyy * igyyL + 0.5 * igxyL * t6;
+  const CCTK_REAL Gamma_yzz = 0.5 * d_z_gzz * igyzL - 0.5 * igxyL * t7 - 0.5 * igyyL * t8;
+  const CCTK_REAL Gamma_zxx = 0.5 * d_x_gxx * igxzL + 0.5 * igyzL * t0 + 0.5 * igzzL * t1;
+  const CCTK_REAL Gamma_zxy = 0.5 * d_x_gyy * igyzL + 0.5 * d_y_gxx * igxzL + 0.5 * igzzL * t2;
+  const CCTK_REAL Gamma_zxz = 0.5 * d_x_gzz * igzzL + 0.5 * d_z_gxx * igxzL + 0.5 * igyzL * t3;
+  const CCTK_REAL Gamma_zyy = 0.5 * d_y_gyy * igyzL - 0.5 * igxzL * t5 + 0.5 * igzzL * t4;
+  const CCTK_REAL Gamma_zyz = 0.5 * d_y_gzz * igzzL + 0.5 * d_z_gyy * igyzL + 0.5 * igxzL * t6;
+  const CCTK_REAL Gamma_zzz = 0.5 * d_z_gzz * igzzL - 0.5 * igxzL * t7 - 0.5 * igyzL * t8;
+
+  const CCTK_REAL dx
+      = Gamma_xxx * igxxL + Gamma_xxy * t9 + Gamma_xxz * t10 + Gamma_xyy * igyyL + Gamma_xyz * t11
+        + Gamma_xzz * igzzL;
+  const CCTK_REAL dy
+      = Gamma_yxx * igxxL + Gamma_yxy * t9 + Gamma_yxz * t10 + Gamma_yyy * igyyL + Gamma_yyz * t11
+        + Gamma_yzz * igzzL;
+  const CCTK_REAL dz
+      = Gamma_zxx * igxxL + Gamma_zxy * t9 + Gamma_zxz * t10 + Gamma_zyy * igyyL + Gamma_zyz * t11
+        + Gamma_zzz * igzzL;
+
+  return {dx, dy, dz};
+}
+
+} // namespace kg
+
+#endif /* CHRISTOFFEL_HPP */
@@ -0,0 +1,437 @@
+/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  Derivatives.hpp
+ *  Finite difference stencil engine. The accuracy order is a template
+ *  parameter, so every kernel is written once and instantiated for all
+ *  the supported orders. Exported to other thorns as
+ *  KleinGordonDerivatives.hpp, so that they share the coefficients.
+ */
+
+#ifndef DERIVATIVES_HPP
+#define DERIVATIVES_HPP
+
+#include "cctk.h"
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace kg {
+
+/***************************************************
+ * Finite difference coefficients                  *
+ *                                                 *
+ * The numerators are the integer weights of each  *
+ * tap, ordered from offset -radius to +radius.    *
+ * The common denominator is kept apart and folded *
+ * with the grid spacing once per kernel call.     *
+ ***************************************************/
+template <int order> struct fd_coefficients;
+
+template <> struct fd_coefficients<4> {
+  static constexpr int radius = 2;
+
+  static constexpr std::array<CCTK_REAL, 5> first{1, -8, 0, 8, -1};
+  static constexpr CCTK_REAL first_den = 12;
+
+  static constexpr std::array<CCTK_REAL, 5> second{-1, 16, -30, 16, -1};
+  static constexpr CCTK_REAL second_den = 12;
+};
+
+template <> struct fd_coefficients<6> {
+  static constexpr int radius = 3;
+
+  static constexpr std::array<CCTK_REAL, 7> first{-1, 9, -45, 0, 45, -9, 1};
+  static constexpr CCTK_REAL first_den = 60;
+
+  static constexpr std::array<CCTK_REAL, 7> second{2, -27, 270, -490, 270, -27, 2};
+  static constexpr CCTK_REAL second_den = 180;
+};
+
+template <> struct fd_coefficients<8> {
+  static constexpr int radius = 4;
+
+  static constexpr std::array<CCTK_REAL, 9> first{3, -32, 168, -672, 0, 672, -168, 32, -3};
+  static constexpr CCTK_REAL first_den = 840;
+
+  static constexpr std::array<CCTK_REAL, 9> second{-9,    128,  -1008, 8064, -14350,
+                                                   8064, -1008, 128,   -9};
+  static constexpr CCTK_REAL second_den = 5040;
+};
+
+/* The orders for which every kernel is instantiated */
+constexpr std::array<int, 3> supported_fd_orders{4, 6, 8};
+
+/**************************************************************************
+ * Coordinate transformation Jacobians at a single point                  *
+ *                                                                        *
+ * Llama assumes that our FD formulas are applied to patch-local          *
+ * coordinates (a, b, c) and that the results are stored in the global    *
+ * cartesian coordinate system (x, y, z). Jij = da^i/dx^j and             *
+ * Jijk = d^2 a^i/(dx^j dx^k).                                            *
+ **************************************************************************/
+struct jacobian {
+  CCTK_REAL J11, J12, J13;
+  CCTK_REAL J21, J22, J23;
+  CCTK_REAL J31, J32, J33;
+};
+
+struct jacobian_derivatives {
+  CCTK_REAL J111, J112, J113, J122, J123, J133;
+  CCTK_REAL J211, J212, J213, J222, J223, J233;
+  CCTK_REAL J311, J312, J313, J322, J323, J333;
+};
+
+/**************************************************
+ * Local derivative bundles                       *
+ *                                                *
+ * Derivatives of a single field with respect to  *
+ * the patch-local coordinates (a, b, c). They    *
+ * are evaluated once per point and then          *
+ * contracted with the Jacobians as many times as *
+ * needed.                                        *
+ **************************************************/
+struct local_gradient {
+  CCTK_REAL da, db, dc;
+};
+
+struct local_derivatives {
+  local_gradient d;
+  CCTK_REAL daa, dab, dac, dbb, dbc, dcc;
+};
+
+/* Derivatives with respect to the global cartesian coordinates */
+struct global_gradient {
+  CCTK_REAL dx, dy, dz;
+};
+
+struct global_hessian {
+  CCTK_REAL dxx, dxy, dxz, dyy, dyz, dzz;
+};
+
+/* d_i f = J_{ai} d_a f */
+inline global_gradient to_global(const local_gradient &l, const jacobian &J) {
+  return {J.J11 * l.da + J.J21 * l.db + J.J31 * l.dc,
+          J.J12 * l.da + J.J22 * l.db + J.J32 * l.dc,
+          J.J13 * l.da + J.J23 * l.db + J.J33 * l.dc};
+}
+
+/* d_ij f = dJ_{aij} d_a f + J_{ai} J_{bj} d_ab f */
+inline global_hessian to_global(const local_derivatives &l, const jacobian &J,
+                                const jacobian_derivatives &dJ) {
+  /* Local hessian contracted with one Jacobian: H_{bi} = J_{ai} d_ab f */
+  const CCTK_REAL Hax = J.J11 * l.daa + J.J21 * l.dab + J.J31 * l.dac;
+  const CCTK_REAL Hbx = J.J11 * l.dab + J.J21 * l.dbb + J.J31 * l.dbc;
+  const CCTK_REAL Hcx = J.J11 * l.dac + J.J21 * l.dbc + J.J31 * l.dcc;
+
+  const CCTK_REAL Hay = J.J12 * l.daa + J.J22 * l.dab + J.J32 * l.dac;
+  const CCTK_REAL Hby = J.J12 * l.dab + J.J22 * l.dbb + J.J32 * l.dbc;
+  const CCTK_REAL Hcy = J.J12 * l.dac + J.J22 * l.dbc + J.J32 * l.dcc;
+
+  const CCTK_REAL Haz = J.J13 * l.daa + J.J23 * l.dab + J.J33 * l.dac;
+  const CCTK_REAL Hbz = J.J13 * l.dab + J.J23 * l.dbb + J.J33 * l.dbc;
+  const CCTK_REAL Hcz = J.J13 * l.dac + J.J23 * l.dbc + J.J33 * l.dcc;
+
+  const local_gradient &g = l.d;
+
+  return {dJ.J111 * g.da + dJ.J211 * g.db + dJ.J311 * g.dc + J.J11 * Hax + J.J21 * Hbx
+              + J.J31 * Hcx,
+          dJ.J112 * g.da + dJ.J212 * g.db + dJ.J312 * g.dc + J.J12 * Hax + J.J22 * Hbx
+              + J.J32 * Hcx,
+          dJ.J113 * g.da + dJ.J213 * g.db + dJ.J313 * g.dc + J.J13 * Hax + J.J23 * Hbx
+              + J.J33 * Hcx,
+          dJ.J122 * g.da + dJ.J222 * g.db + dJ.J322 * g.dc + J.J12 * Hay + J.J22 * Hby
+              + J.J32 * Hcy,
+          dJ.J123 * g.da + dJ.J223 * g.db + dJ.J323 * g.dc + J.J13 * Hay + J.J23 * Hby
+              + J.J33 * Hcy,
+          dJ.J133 * g.da + dJ.J233 * g.db + dJ.J333 * g.dc + J.J13 * Haz + J.J23 * Hbz
+              + J.J33 * Hcz};
+}
+
+/**************************************************
+ * kg::stencil<order>                             *
+ *                                                *
+ * Centered finite difference operators acting on *
+ * patch-local directions 0, 1, 2 = (a, b, c).    *
+ * Taps are addressed by precomputed strides      *
+ * relative to the linear index of the point, so  *
+ * no index flattening happens per tap.           *
+ **************************************************/
+template <int order> class stencil {
+public:
+  using coefficients = fd_coefficients<order>;
+  static constexpr int radius = coefficients::radius;
+  static constexpr int width = 2 * radius + 1;
+
+  explicit stencil(const cGH *const cctkGH)
+      : strides{CCTK_GFINDEX3D(cctkGH, 1, 0, 0) - CCTK_GFINDEX3D(cctkGH, 0, 0, 0),
+                CCTK_GFINDEX3D(cctkGH, 0, 1, 0) - CCTK_GFINDEX3D(cctkGH, 0, 0, 0),
+                CCTK_GFINDEX3D(cctkGH, 0, 0, 1) - CCTK_GFINDEX3D(cctkGH, 0, 0, 0)} {
+    for (int d = 0; d < 3; d++) {
+      first_factor[d] = 1.0 / (coefficients::first_den * CCTK_DELTA_SPACE(d));
+      second_factor[d]
+          = 1.0 / (coefficients::second_den * CCTK_DELTA_SPACE(d) * CCTK_DELTA_SPACE(d));
+    }
+  }
+
+  /* First derivative along the local direction dir */
+  template <int dir> inline CCTK_REAL d(const CCTK_REAL *f, std::ptrdiff_t ijk) const {
+    return line<dir, coefficients::first>(f + ijk) * first_factor[dir];
+  }
+
+  /* Second derivative along the local direction dir */
+  template <int dir> inline CCTK_REAL dd(const CCTK_REAL *f, std::ptrdiff_t ijk) const {
+    return line<dir, coefficients::second>(f + ijk) * second_factor[dir];
+  }
+
+  /* Mixed second derivative along the local directions dir1 != dir2 */
+  template <int dir1, int dir2>
+  inline CCTK_REAL dd(const CCTK_REAL *f, std::ptrdiff_t ijk) const {
+    static_assert(dir1 != dir2, "Use dd<dir> for pure second derivatives");
+    return mixed<dir1, dir2>(f + ijk, std::make_integer_sequence<int, width>{}) * first_factor[dir1]
+           * first_factor[dir2];
+  }
+
+  /* The three first local derivatives of f */
+  inline local_gradient gradient(const CCTK_REAL *f, std::ptrdiff_t ijk) const {
+    return {d<0>(f, ijk), d<1>(f, ijk), d<2>(f, ijk)};
+  }
+
+  /* The three first and six second local derivatives of f */
+  inline local_derivatives derivatives(const CCTK_REAL *f, std::ptrdiff_t ijk) const {
+    return {gradient(f, ijk), dd<0>(f, ijk),    dd<0, 1>(f, ijk), dd<0, 2>(f, ijk),
+            dd<1>(f, ijk),    dd<1, 2>(f, ijk), dd<2>(f, ijk)};
+  }
+
+private:
+  template <int> friend class rolling_derivatives;
+
+  /**************************************************
+   * The sums over taps are expanded at compile     *
+   * time, so the kernels are free of inner loops   *
+   * and branches and vectorize along i. Taps with  *
+   * a zero weight are skipped. The terms are added *
+   * in increasing offset order.                    *
+   **************************************************/
+
+  /* Weighted tap n along dir, centered at f */
+  template <int dir, const std::array<CCTK_REAL, width> &c, int n>
+  inline CCTK_REAL tap(const CCTK_REAL *f) const {
+    if constexpr (c[n] != 0)
+      return c[n] * f[(n - radius) * strides[dir]];
+    else
+      return 0;
+  }
+
+  /* Weighted sum of the taps along dir, centered at f */
+  template <int dir, const std::array<CCTK_REAL, width> &c, int... n>
+  inline CCTK_REAL line(const CCTK_REAL *f, std::integer_sequence<int, n...>) const {
+    return (CCTK_REAL(0) + ... + tap<dir, c, n>(f));
+  }
+
+  template <int dir, const std::array<CCTK_REAL, width> &c>
+  inline CCTK_REAL line(const CCTK_REAL *f) const {
+    return line<dir, c>(f, std::make_integer_sequence<int, width>{});
+  }
+
+  /* Tap n along dir2 of the first derivative along dir1 */
+  template <int dir1, int dir2, int n> inline CCTK_REAL mixed_tap(const CCTK_REAL *f) const {
+    if constexpr (coefficients::first[n] != 0)
+      return coefficients::first[n]
+             * line<dir1, coefficients::first>(f + (n - radius) * strides[dir2]);
+    else
+      return 0;
+  }
+
+  template <int dir1, int dir2, int... n>
+  inline CCTK_REAL mixed(const CCTK_REAL *f, std::integer_sequence<int, n...>) const {
+    return (CCTK_REAL(0) + ... + mixed_tap<dir1, dir2, n>(f));
+  }
+
+  std::array<std::ptrdiff_t, 3> strides;
+  std::array<CCTK_REAL, 3> first_factor;
+  std::array<CCTK_REAL, 3> second_factor;
+};
+
+/**************************************************
+ * kg::rolling_derivatives<order>                 *
+ *                                                *
+ * All first and second local derivatives of a    *
+ * field over a block of points, with the mixed   *
+ * derivatives evaluated separably. The first     *
+ * derivatives along a and b are stored in a ring *
+ * of 2 * radius + 1 planes of constant c, and    *
+ * the mixed derivatives are their first          *
+ * derivatives along b and c. Each point then     *
+ * loads O(order) values instead of O(order^2).   *
+ * The sums are carried out in the same order as  *
+ * in stencil::dd<dir1, dir2>, so the results are *
+ * identical.                                     *
+ *                                                *
+ * Planes are swept with advance(k) for k         *
+ * increasing by one from kmin. The storage is    *
+ * private to each thread and reused across       *
+ * blocks.                                        *
+ **************************************************/
+template <int order> class rolling_derivatives {
+public:
+  using coefficients = fd_coefficients<order>;
+  static constexpr int radius = coefficients::radius;
+  static constexpr int width = 2 * radius + 1;
+
+  rolling_derivatives(const stencil<order> &D, const CCTK_REAL *f, CCTK_INT imin, CCTK_INT imax,
+                      CCTK_INT jmin, CCTK_INT jmax, CCTK_INT kmin)
+      : D(D), f(f), imin(imin), jmin(jmin), ni(imax - imin), nj(jmax - jmin),
+        a_plane_size((nj + 2 * radius) * ni), b_plane_size(nj * ni) {
+    std::vector<CCTK_REAL> &a_storage = storage(0);
+    std::vector<CCTK_REAL> &b_storage = storage(1);
+
+    if (a_storage.size() < static_cast<std::size_t>(width * a_plane_size))
+      a_storage.resize(width * a_plane_size);
+
+    if (b_storage.size() < static_cast<std::size_t>(width * b_plane_size))
+      b_storage.resize(width * b_plane_size);
+
+    a_planes = a_storage.data();
+    b_planes = b_storage.data();
+
+    for (CCTK_INT k = kmin - radius; k < kmin + radius; k++)
+      fill(k);
+  }
+
+  /* Makes the plane k current. Must be called for k = kmin, kmin + 1, ... */
+  void advance(CCTK_INT k) {
+    fill(k + radius);
+    for (int n = 0; n < width; n++)
+      slots[n] = (k + n - radius) % width;
+  }
+
+  /* All local derivatives at (i, j) on the current plane, with linear index ijk */
+  inline local_derivatives derivatives(CCTK_INT i, CCTK_INT j, std::ptrdiff_t ijk) const {
+    const std::ptrdiff_t a_row = (j - jmin + radius) * ni + (i - imin);
+    const std::ptrdiff_t b_row = (j - jmin) * ni + (i - imin);
+
+    const CCTK_REAL *const a = a_planes + slots[radius] * a_plane_size + a_row;
+    const CCTK_REAL *const b = b_planes + slots[radius] * b_plane_size + b_row;
+
+    const auto seq = std::make_integer_sequence<int, width>{};
+
+    return {{a[0] * D.first_factor[0], b[0] * D.first_factor[1], D.template d<2>(f, ijk)},
+            D.template dd<0>(f, ijk),
+            along_b(a, seq) * D.first_factor[0] * D.first_factor[1],
+            along_c(a_planes, a_plane_size, a_row, seq) * D.first_factor[0] * D.first_factor[2],
+            D.template dd<1>(f, ijk),
+            along_c(b_planes, b_plane_size, b_row, seq) * D.first_factor[1] * D.first_factor[2],
+            D.template dd<2>(f, ijk)};
+  }
+
+private:
+  static std::vector<CCTK_REAL> &storage(int n) {
+    thread_local std::array<std::vector<CCTK_REAL>, 2> buffers;
+    return buffers[n];
+  }
+
+  /* Unscaled first derivatives along a and b on the plane k */
+  void fill(CCTK_INT k) {
+    const std::ptrdiff_t slot = k % width;
+
+    for (CCTK_INT j = jmin - radius; j < jmin + nj + radius; j++) {
+      const CCTK_REAL *const row = f + imin * D.strides[0] + j * D.strides[1] + k * D.strides[2];
+      CCTK_REAL *const a = a_planes + slot * a_plane_size + (j - jmin + radius) * ni;
+
+      for (CCTK_INT i = 0; i < ni; i++)
+        a[i] = D.template line<0, coefficients::first>(row + i * D.strides[0]);
+    }
+
+    for (CCTK_INT j = jmin; j < jmin + nj; j++) {
+      const CCTK_REAL *const row = f + imin * D.strides[0] + j * D.strides[1] + k * D.strides[2];
+      CCTK_REAL *const b = b_planes + slot * b_plane_size + (j - jmin) * ni;
+
+      for (CCTK_INT i = 0; i < ni; i++)
+        b[i] = D.template line<1, coefficients::first>(row + i * D.strides[0]);
+    }
+  }
+
+  template <int n> inline CCTK_REAL along_b_tap(const CCTK_REAL *a) const {
+    if constexpr (coefficients::first[n] != 0)
+      return coefficients::first[n] * a[(n - radius) * ni];
+    else
+      return 0;
+  }
+
+  template <int... n>
+  inline CCTK_REAL along_b(const CCTK_REAL *a, std::integer_sequence<int, n...>) const {
+    return (CCTK_REAL(0) + ... + along_b_tap<n>(a));
+  }
+
+  template <int n>
+  inline CCTK_REAL along_c_tap(const CCTK_REAL *planes, std::ptrdiff_t plane_size,
+                               std::ptrdiff_t row) const {
+    if constexpr (coefficients::first[n] != 0)
+      return coefficients::first[n] * planes[slots[n] * plane_size + row];
+    else
+      return 0;
+  }
+
+  template <int... n>
+  inline CCTK_REAL along_c(const CCTK_REAL *planes, std::ptrdiff_t plane_size, std::ptrdiff_t row,
+                           std::integer_sequence<int, n...>) const {
+    return (CCTK_REAL(0) + ... + along_c_tap<n>(planes, plane_size, row));
+  }
+
+  const stencil<order> &D;
+  const CCTK_REAL *const f;
+
+  const CCTK_INT imin, jmin, ni, nj;
+  const std::ptrdiff_t a_plane_size, b_plane_size;
+
+  CCTK_REAL *a_planes, *b_planes;
+
+  /* Ring slots of the planes current - radius, ..., current + radius */
+  std::array<std::ptrdiff_t, width> slots{};
+};
+
+/**************************************************
+ * Kernel dispatch                                *
+ *                                                *
+ * Kernels are class templates on the FD order    *
+ * exposing a static compute(CCTK_ARGUMENTS)      *
+ * member. select_kernel returns the instance     *
+ * matching the runtime fd_order parameter.       *
+ **************************************************/
+template <template <int> class kernel> inline auto select_kernel(CCTK_INT order) {
+  using kernel_ptr = decltype(&kernel<4>::compute);
+
+  constexpr std::array<kernel_ptr, supported_fd_orders.size()> table{
+      &kernel<4>::compute, &kernel<6>::compute, &kernel<8>::compute};
+
+  for (std::size_t n = 0; n < supported_fd_orders.size(); n++) {
+    if (supported_fd_orders[n] == order)
+      return table[n];
+  }
+
+  CCTK_VERROR("Finite difference order %d is not implemented", static_cast<int>(order));
+  return kernel_ptr{nullptr};
+}
+
+} // namespace kg
+
+#endif /* DERIVATIVES_HPP */
@@ -17,7 +17,7 @@
  *  You should have received a copy of the GNU General Public License
  *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
  *
- * Error.c
+ * Error.cpp
  * Calculate the wave equation's solution error.
  * This error measure only makes sense when evolving an "exact_gaussian"
  * pulse in a Minkowski background.
@@ -26,14 +26,14 @@
 /*************************
  * This thorn's includes *
  *************************/
-#include "Derivatives.h"
+#include "AnalyticSolutions.hpp"
 #include "KleinGordon.h"
+#include "Simd.hpp"
 
 /**************************
- * C std. lib. includes   *
- * and external libraries *
+ * C++ std. lib. includes *
  **************************/
-#include <math.h>
+#include <cmath>
 
 void KleinGordon_Error(CCTK_ARGUMENTS) {
   DECLARE_CCTK_ARGUMENTS;
@@ -41,21 +41,20 @@ void KleinGordon_Error(CCTK_ARGUMENTS) {
 
   /* Time values */
   const CCTK_REAL t = cctk_time;
-  CCTK_REAL analytic_Phi = 0.0, analytic_K_Phi = 0.0;
 
-#pragma omp parallel
-  CCTK_LOOP3_ALL(loop_error, cctkGH, i, j, k) {
+#pragma omp parallel for collapse(2)
+  for (CCTK_INT k = 0; k < cctk_lsh[2]; k++) {
+    for (CCTK_INT j = 0; j < cctk_lsh[1]; j++) {
+      kg::simd_row(0, cctk_lsh[0], [&](CCTK_INT i) {
+        const CCTK_INT ijk = CCTK_GFINDEX3D(cctkGH, i, j, k);
 
-    const CCTK_INT ijk = CCTK_GFINDEX3D(cctkGH, i, j, k);
+        const analytic::wave_state<CCTK_REAL> s
+            = analytic::exact_gaussian(t, x[ijk] - gaussian_x0, y[ijk] - gaussian_y0,
+                                       z[ijk] - gaussian_z0, 1.0, gaussian_sigma);
 
-    analytic_Phi = cartesian_gaussian_solution(t, x[ijk] - gaussian_x0, y[ijk] - gaussian_y0,
-                                               z[ijk] - gaussian_z0, gaussian_sigma);
-    analytic_K_Phi = -0.5
-                     * cartesian_gaussian_solution_dt(t, x[ijk] - gaussian_x0, y[ijk] - gaussian_y0,
-                                                      z[ijk] - gaussian_z0, gaussian_sigma);
-
-    Phi_err[ijk] = fabs(Phi[ijk] - analytic_Phi);
-    K_Phi_err[ijk] = fabs(K_Phi[ijk] - analytic_K_Phi);
+        Phi_err[ijk] = std::fabs(Phi[ijk] - s.Phi);
+        K_Phi_err[ijk] = std::fabs(K_Phi[ijk] + 0.5 * s.d_t_Phi);
+      });
+    }
   }
-  CCTK_ENDLOOP3_ALL(loop_error);
 }
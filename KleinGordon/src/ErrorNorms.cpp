@@ -0,0 +1,75 @@
+/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  ErrorNorms.cpp
+ *  Norms of the error of an "exact_gaussian" evolution in a Minkowski
+ *  background, reduced directly from the evolved variables without
+ *  storing error_group. The sums are reduced by Reductions.hpp.
+ */
+
+/*************************
+ * This thorn's includes *
+ *************************/
+#include "AnalyticSolutions.hpp"
+#include "KleinGordon.h"
+#include "Reductions.hpp"
+
+#include <array>
+#include <cmath>
+
+namespace {
+
+/* Process local sums of Phi and K_Phi, filled component by component */
+reduction::per_level<reduction::norm_sums<2>> level_sums;
+
+} // namespace
+
+extern "C" void KleinGordon_ErrorNorms(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS;
+  DECLARE_CCTK_PARAMETERS;
+
+  const CCTK_REAL t = cctk_time;
+
+  reduction::add_norms(cctkGH, level_sums.current(cctkGH), [&](CCTK_INT ijk) {
+    const analytic::wave_state<CCTK_REAL> s
+        = analytic::exact_gaussian(t, x[ijk] - gaussian_x0, y[ijk] - gaussian_y0,
+                                   z[ijk] - gaussian_z0, 1.0, gaussian_sigma);
+
+    return std::array<CCTK_REAL, 2>{std::fabs(Phi[ijk] - s.Phi),
+                                    std::fabs(K_Phi[ijk] + 0.5 * s.d_t_Phi)};
+  });
+}
+
+extern "C" void KleinGordon_ReduceErrorNorms(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS;
+
+  reduction::norm_sums<2> &sums = level_sums.current(cctkGH);
+
+  const auto [Phi_norms, K_Phi_norms] = reduction::reduce_norms(cctkGH, sums);
+
+  *Phi_err_norm1 = Phi_norms.norm1;
+  *Phi_err_norm2 = Phi_norms.norm2;
+  *Phi_err_norm_inf = Phi_norms.norm_inf;
+
+  *K_Phi_err_norm1 = K_Phi_norms.norm1;
+  *K_Phi_err_norm2 = K_Phi_norms.norm2;
+  *K_Phi_err_norm_inf = K_Phi_norms.norm_inf;
+
+  sums = reduction::norm_sums<2>{};
+}
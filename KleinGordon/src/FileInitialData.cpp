@@ -0,0 +1,225 @@
+/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  FileInitialData.cpp
+ *  "from_file" initial data. The dataset is memory mapped, so that only the
+ *  pages around the points of the local components are read from disk and
+ *  no copy of it is kept in memory. Phi and K_Phi are interpolated onto the
+ *  global coordinates of every point, so the same dataset serves Cartesian
+ *  grids and Llama's patches alike.
+ *
+ *  The file holds, in the native byte order of the machine:
+ *
+ *    char    magic[8]     "KGIDATA1"
+ *    int64_t n[3]         number of points along x, y and z
+ *    double  origin[3]    coordinates of the first point
+ *    double  delta[3]     spacing of the points along x, y and z
+ *    double  Phi[n[2]][n[1]][n[0]]
+ *    double  K_Phi[n[2]][n[1]][n[0]]
+ *
+ *  so that x varies fastest, as in Cactus grid functions.
+ */
+
+/*************************
+ * This thorn's includes *
+ *************************/
+#include "FileInitialData.hpp"
+#include "KleinGordon.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+struct file_header {
+  char magic[8];
+  std::int64_t n[3];
+  double origin[3];
+  double delta[3];
+};
+
+static_assert(sizeof(file_header) == 80, "file_header must match the layout on disk");
+
+constexpr char file_magic[8] = {'K', 'G', 'I', 'D', 'A', 'T', 'A', '1'};
+
+/* Largest supported interpolation order, limited by initial_data_interpolation_order */
+constexpr int max_order = 8;
+
+/* Read only mapping of a whole file, released when it goes out of scope */
+class mapped_file {
+public:
+  explicit mapped_file(const char *path) {
+    const int fd = open(path, O_RDONLY);
+
+    if (fd < 0)
+      CCTK_VERROR("Could not open the initial data file \"%s\": %s", path, std::strerror(errno));
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0) {
+      close(fd);
+      CCTK_VERROR("Could not stat the initial data file \"%s\": %s", path, std::strerror(errno));
+    }
+
+    size = static_cast<std::size_t>(st.st_size);
+
+    if (size < sizeof(file_header)) {
+      close(fd);
+      CCTK_VERROR("The initial data file \"%s\" is too small to hold a header", path);
+    }
+
+    void *const map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (map == MAP_FAILED)
+      CCTK_VERROR("Could not map the initial data file \"%s\": %s", path, std::strerror(errno));
+
+    data = static_cast<const char *>(map);
+  }
+
+  ~mapped_file() { munmap(const_cast<char *>(data), size); }
+
+  mapped_file(const mapped_file &) = delete;
+  mapped_file &operator=(const mapped_file &) = delete;
+
+  const char *data = nullptr;
+  std::size_t size = 0;
+};
+
+/* Lagrange stencil of one direction: first point and weights of its order + 1 points */
+struct stencil_1d {
+  std::int64_t first;
+  CCTK_REAL w[max_order + 1];
+};
+
+/* Stencil centered on the fractional index s, shifted inwards near the ends of the dataset.
+ * Returns false if s lies outside of the dataset by more than a round-off tolerance. */
+bool lagrange_stencil(CCTK_REAL s, std::int64_t n, int order, stencil_1d &st) {
+  const CCTK_REAL tolerance = 1.0e-10;
+
+  if (s < -tolerance || s > (n - 1) + tolerance)
+    return false;
+
+  st.first = static_cast<std::int64_t>(std::floor(s - 0.5 * (order - 1)));
+  st.first = std::clamp<std::int64_t>(st.first, 0, n - 1 - order);
+
+  for (int m = 0; m <= order; m++) {
+    CCTK_REAL w = 1.0;
+
+    for (int l = 0; l <= order; l++) {
+      if (l != m)
+        w *= (s - (st.first + l)) / (m - l);
+    }
+
+    st.w[m] = w;
+  }
+
+  return true;
+}
+
+} // namespace
+
+void kg::initialize_from_file(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS;
+  DECLARE_CCTK_PARAMETERS;
+
+  const int order = initial_data_interpolation_order;
+
+  const mapped_file file(initial_data_file);
+
+  file_header header;
+  std::memcpy(&header, file.data, sizeof(header));
+
+  if (std::memcmp(header.magic, file_magic, sizeof(file_magic)) != 0)
+    CCTK_VERROR("\"%s\" is not a KleinGordon initial data file", initial_data_file);
+
+  for (int d = 0; d < 3; d++) {
+    if (header.n[d] < order + 1)
+      CCTK_VERROR("The initial data file \"%s\" has %lld points along direction %d, but order %d "
+                  "interpolation requires at least %d",
+                  initial_data_file, static_cast<long long>(header.n[d]), d, order, order + 1);
+
+    if (!(header.delta[d] > 0))
+      CCTK_VERROR("The initial data file \"%s\" has a non positive spacing along direction %d",
+                  initial_data_file, d);
+  }
+
+  const std::int64_t nx = header.n[0], ny = header.n[1], nz = header.n[2];
+  const std::int64_t npoints = nx * ny * nz;
+
+  if (file.size != sizeof(file_header) + 2 * npoints * sizeof(double))
+    CCTK_VERROR("The size of the initial data file \"%s\" does not match its %lld x %lld x %lld "
+                "points",
+                initial_data_file, static_cast<long long>(nx), static_cast<long long>(ny),
+                static_cast<long long>(nz));
+
+  /* The header is 80 bytes long, so both arrays are aligned to doubles */
+  const double *const file_Phi = reinterpret_cast<const double *>(file.data + sizeof(file_header));
+  const double *const file_K_Phi = file_Phi + npoints;
+
+  CCTK_INT outside = 0;
+
+#pragma omp parallel for collapse(2) reduction(+ : outside)
+  for (CCTK_INT k = 0; k < cctk_lsh[2]; k++) {
+    for (CCTK_INT j = 0; j < cctk_lsh[1]; j++) {
+      for (CCTK_INT i = 0; i < cctk_lsh[0]; i++) {
+        const CCTK_INT ijk = CCTK_GFINDEX3D(cctkGH, i, j, k);
+
+        stencil_1d sx, sy, sz;
+
+        if (!lagrange_stencil((x[ijk] - header.origin[0]) / header.delta[0], nx, order, sx)
+            || !lagrange_stencil((y[ijk] - header.origin[1]) / header.delta[1], ny, order, sy)
+            || !lagrange_stencil((z[ijk] - header.origin[2]) / header.delta[2], nz, order, sz)) {
+          outside++;
+          continue;
+        }
+
+        CCTK_REAL PhiL = 0.0, K_PhiL = 0.0;
+
+        for (int c = 0; c <= order; c++) {
+          for (int b = 0; b <= order; b++) {
+            const CCTK_REAL w_bc = sy.w[b] * sz.w[c];
+            const std::int64_t row = ((sz.first + c) * ny + (sy.first + b)) * nx + sx.first;
+
+            for (int a = 0; a <= order; a++) {
+              PhiL += sx.w[a] * w_bc * file_Phi[row + a];
+              K_PhiL += sx.w[a] * w_bc * file_K_Phi[row + a];
+            }
+          }
+        }
+
+        Phi[ijk] = PhiL;
+        K_Phi[ijk] = K_PhiL;
+      }
+    }
+  }
+
+  if (outside > 0)
+    CCTK_VERROR("%d points of the grid lie outside of the dataset in the initial data file \"%s\"",
+                static_cast<int>(outside), initial_data_file);
+}
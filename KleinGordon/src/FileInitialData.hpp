@@ -0,0 +1,42 @@
+/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  FileInitialData.hpp
+ *  Initial data interpolated from a Cartesian dataset stored in a file.
+ */
+
+#ifndef FILE_INITIAL_DATA_HPP
+#define FILE_INITIAL_DATA_HPP
+
+#include "cctk.h"
+#include "cctk_Arguments.h"
+
+namespace kg {
+
+/**************************************************
+ * Fills Phi and K_Phi on every point of the      *
+ * local components, on any patch, by Lagrange    *
+ * interpolation of the dataset in                *
+ * initial_data_file.                             *
+ **************************************************/
+void initialize_from_file(CCTK_ARGUMENTS);
+
+} // namespace kg
+
+#endif /* FILE_INITIAL_DATA_HPP */
@@ -0,0 +1,83 @@
+/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  FusedTmunu.hpp
+ *  Splits the field contribution to Tmunu between the RHS kernel and
+ *  KleinGordon_CalcTmunu when fuse_Tmunu_with_RHS is set.
+ */
+
+#ifndef FUSED_TMUNU_HPP
+#define FUSED_TMUNU_HPP
+
+#include "cctk.h"
+#include "cctk_Arguments.h"
+#include "cctk_Parameters.h"
+
+namespace kg {
+
+/***************************************************
+ * TmunuBase zeroes Tmunu and rebuilds it in       *
+ * AddToTmunu after every MoL substep, and at      *
+ * initial time, regridding and recovery. The      *
+ * next RHS evaluation uses the same state.        *
+ *                                                 *
+ * With fuse_Tmunu_with_RHS, KleinGordon_CalcTmunu *
+ * only skips AddToTmunu after the intermediate    *
+ * substeps of a MoL step, and the RHS adds the    *
+ * field contribution on the substeps that follow  *
+ * them. Tmunu is therefore complete whenever      *
+ * other thorns may read it: in the RHS, at        *
+ * analysis and in the output.                     *
+ ***************************************************/
+
+/* MoL's count of the substeps left in the current step, or nullptr without MoL */
+inline const CCTK_INT *mol_intermediate_step(const cGH *cctkGH) {
+  const int index = CCTK_VarIndex("MethodOfLines::MoL_Intermediate_Step");
+  return index >= 0 ? static_cast<const CCTK_INT *>(CCTK_VarDataPtrI(cctkGH, 0, index))
+                    : nullptr;
+}
+
+/* Whether the RHS evaluated now has to add the field contribution to Tmunu. On the first
+ * substep of a step the state is the one Tmunu was built from in AddToTmunu. */
+inline bool rhs_adds_tmunu(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_PARAMETERS;
+
+  if (!(compute_Tmunu && fuse_Tmunu_with_RHS) || cctkGH->cctk_iteration == 0)
+    return false;
+
+  const CCTK_INT *const substep = mol_intermediate_step(cctkGH);
+
+  return substep && *substep > 0 && *substep < MoL_Intermediate_Steps;
+}
+
+/* Whether KleinGordon_CalcTmunu has to add the field contribution in AddToTmunu now */
+inline bool calc_tmunu_adds_tmunu(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_PARAMETERS;
+
+  if (!fuse_Tmunu_with_RHS || cctkGH->cctk_iteration == 0)
+    return true;
+
+  const CCTK_INT *const substep = mol_intermediate_step(cctkGH);
+
+  return !substep || *substep == 0;
+}
+
+} // namespace kg
+
+#endif /* FUSED_TMUNU_HPP */
@@ -0,0 +1,325 @@
+/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  Generated.hpp
+ *  Point-wise tensor algebra of the evolution equations, the energy
+ *  momentum tensor and the energy density.
+ *
+ *  Generated by Notebooks/generate_kernels.py. Do not edit by hand.
+ */
+
+#ifndef GENERATED_HPP
+#define GENERATED_HPP
+
+#include "Background.hpp"
+#include "Derivatives.hpp"
+
+namespace kg {
+
+struct stress_energy_tensor {
+  CCTK_REAL tt, tx, ty, tz, xx, xy, xz, yy, yz, zz;
+};
+
+/*
+ * Energy momentum tensor of the field, T_ab = d_a Phi d_b Phi + g_ab L / 2,
+ * with L = -m^2 Phi^2 - g^{ab} d_a Phi d_b Phi.
+ */
+inline stress_energy_tensor compute_stress_energy(CCTK_REAL alpL, CCTK_REAL betaxL,
+                                                  CCTK_REAL betayL, CCTK_REAL betazL,
+                                                  const symmetric3 &h, const symmetric3 &ih,
+                                                  CCTK_REAL PhiL, CCTK_REAL K_PhiL,
+                                                  const global_gradient &d_Phi,
+                                                  CCTK_REAL field_mass) {
+  const CCTK_REAL hxxL = h.xx;
+  const CCTK_REAL hxyL = h.xy;
+  const CCTK_REAL hxzL = h.xz;
+  const CCTK_REAL hyyL = h.yy;
+  const CCTK_REAL hyzL = h.yz;
+  const CCTK_REAL hzzL = h.zz;
+  const CCTK_REAL ihxxL = ih.xx;
+  const CCTK_REAL ihxyL = ih.xy;
+  const CCTK_REAL ihxzL = ih.xz;
+  const CCTK_REAL ihyyL = ih.yy;
+  const CCTK_REAL ihyzL = ih.yz;
+  const CCTK_REAL ihzzL = ih.zz;
+  const CCTK_REAL d_x_Phi = d_Phi.dx;
+  const CCTK_REAL d_y_Phi = d_Phi.dy;
+  const CCTK_REAL d_z_Phi = d_Phi.dz;
+
+  const CCTK_REAL t0 = alpL * alpL;
+  const CCTK_REAL t1 = betaxL * d_x_Phi + betayL * d_y_Phi + betazL * d_z_Phi;
+  const CCTK_REAL t2 = 1.0 / t0;
+  const CCTK_REAL t3 = betaxL * t2;
+  const CCTK_REAL t4 = -betayL * t3 + ihxyL;
+  const CCTK_REAL t5 = -betazL * t3 + ihxzL;
+  const CCTK_REAL t6 = betayL * t2;
+  const CCTK_REAL t7 = -betazL * t6 + ihyzL;
+  const CCTK_REAL ibetaxL = betaxL * hxxL + betayL * hxyL + betazL * hxzL;
+  const CCTK_REAL ibetayL = betaxL * hxyL + betayL * hyyL + betazL * hyzL;
+  const CCTK_REAL ibetazL = betaxL * hxzL + betayL * hyzL + betazL * hzzL;
+  const CCTK_REAL gttL = betaxL * ibetaxL + betayL * ibetayL + betazL * ibetazL - t0;
+  const CCTK_REAL d_t_Phi = -2 * K_PhiL * alpL + t1;
+  const CCTK_REAL t8 = d_t_Phi * t2;
+  const CCTK_REAL L
+      = -PhiL * PhiL * field_mass * field_mass
+        - d_x_Phi
+          * (d_t_Phi * t3 + d_x_Phi * (-betaxL * betaxL * t2 + ihxxL) + d_y_Phi * t4 + d_z_Phi * t5)
+        - d_y_Phi
+          * (d_t_Phi * t6 + d_x_Phi * t4 + d_y_Phi * (-betayL * betayL * t2 + ihyyL) + d_z_Phi * t7)
+        - d_z_Phi
+          * (betazL * t8 + d_x_Phi * t5 + d_y_Phi * t7 + d_z_Phi * (-betazL * betazL * t2 + ihzzL))
+        - t8 * (-d_t_Phi + t1);
+  const CCTK_REAL t9 = 0.5 * L;
+
+  const CCTK_REAL tt = d_t_Phi * d_t_Phi + gttL * t9;
+  const CCTK_REAL tx = d_t_Phi * d_x_Phi + ibetaxL * t9;
+  const CCTK_REAL ty = d_t_Phi * d_y_Phi + ibetayL * t9;
+  const CCTK_REAL tz = d_t_Phi * d_z_Phi + ibetazL * t9;
+  const CCTK_REAL xx = d_x_Phi * d_x_Phi + hxxL * t9;
+  const CCTK_REAL xy = d_x_Phi * d_y_Phi + hxyL * t9;
+  const CCTK_REAL xz = d_x_Phi * d_z_Phi + hxzL * t9;
+  const CCTK_REAL yy = d_y_Phi * d_y_Phi + hyyL * t9;
+  const CCTK_REAL yz = d_y_Phi * d_z_Phi + hyzL * t9;
+  const CCTK_REAL zz = d_z_Phi * d_z_Phi + hzzL * t9;
+
+  return {tt, tx, ty, tz, xx, xy, xz, yy, yz, zz};
+}
+
+/* Energy density of the field, T_tt */
+inline CCTK_REAL compute_energy_density(CCTK_REAL alpL, CCTK_REAL betaxL, CCTK_REAL betayL,
+                                        CCTK_REAL betazL, const symmetric3 &h, const symmetric3 &ih,
+                                        CCTK_REAL PhiL, CCTK_REAL K_PhiL,
+                                        const global_gradient &d_Phi, CCTK_REAL field_mass) {
+  const CCTK_REAL hxxL = h.xx;
+  const CCTK_REAL hxyL = h.xy;
+  const CCTK_REAL hxzL = h.xz;
+  const CCTK_REAL hyyL = h.yy;
+  const CCTK_REAL hyzL = h.yz;
+  const CCTK_REAL hzzL = h.zz;
+  const CCTK_REAL ihxxL = ih.xx;
+  const CCTK_REAL ihxyL = ih.xy;
+  const CCTK_REAL ihxzL = ih.xz;
+  const CCTK_REAL ihyyL = ih.yy;
+  const CCTK_REAL ihyzL = ih.yz;
+  const CCTK_REAL ihzzL = ih.zz;
+  const CCTK_REAL d_x_Phi = d_Phi.dx;
+  const CCTK_REAL d_y_Phi = d_Phi.dy;
+  const CCTK_REAL d_z_Phi = d_Phi.dz;
+
+  const CCTK_REAL t0 = alpL * alpL;
+  const CCTK_REAL t1 = betaxL * d_x_Phi + betayL * d_y_Phi + betazL * d_z_Phi;
+  const CCTK_REAL t2 = 1.0 / t0;
+  const CCTK_REAL t3 = betaxL * t2;
+  const CCTK_REAL t4 = -betayL * t3 + ihxyL;
+  const CCTK_REAL t5 = -betazL * t3 + ihxzL;
+  const CCTK_REAL t6 = betayL * t2;
+  const CCTK_REAL t7 = -betazL * t6 + ihyzL;
+  const CCTK_REAL ibetaxL = betaxL * hxxL + betayL * hxyL + betazL * hxzL;
+  const CCTK_REAL ibetayL = betaxL * hxyL + betayL * hyyL + betazL * hyzL;
+  const CCTK_REAL ibetazL = betaxL * hxzL + betayL * hyzL + betazL * hzzL;
+  const CCTK_REAL gttL = betaxL * ibetaxL + betayL * ibetayL + betazL * ibetazL - t0;
+  const CCTK_REAL d_t_Phi = -2 * K_PhiL * alpL + t1;
+  const CCTK_REAL t8 = d_t_Phi * t2;
+  const CCTK_REAL L
+      = -PhiL * PhiL * field_mass * field_mass
+        - d_x_Phi
+          * (d_t_Phi * t3 + d_x_Phi * (-betaxL * betaxL * t2 + ihxxL) + d_y_Phi * t4 + d_z_Phi * t5)
+        - d_y_Phi
+          * (d_t_Phi * t6 + d_x_Phi * t4 + d_y_Phi * (-betayL * betayL * t2 + ihyyL) + d_z_Phi * t7)
+        - d_z_Phi
+          * (betazL * t8 + d_x_Phi * t5 + d_y_Phi * t7 + d_z_Phi * (-betazL * betazL * t2 + ihzzL))
+        - t8 * (-d_t_Phi + t1);
+
+  return 0.5 * L * gttL + d_t_Phi * d_t_Phi;
+}
+
+/* K_Phi right hand side at one point, Eq. (A3d) of arXiv:1709.06118 */
+inline CCTK_REAL K_Phi_rhs_point(const background &b, CCTK_REAL alpL, CCTK_REAL betaxL,
+                                 CCTK_REAL betayL, CCTK_REAL betazL, CCTK_REAL PhiL,
+                                 CCTK_REAL K_PhiL, const global_gradient &d_Phi,
+                                 const global_hessian &dd_Phi, const global_gradient &d_K_Phi,
+                                 CCTK_REAL field_mass) {
+  const CCTK_REAL igxx = b.ig.xx;
+  const CCTK_REAL igxy = b.ig.xy;
+  const CCTK_REAL igxz = b.ig.xz;
+  const CCTK_REAL igyy = b.ig.yy;
+  const CCTK_REAL igyz = b.ig.yz;
+  const CCTK_REAL igzz = b.ig.zz;
+  const CCTK_REAL K_trace = b.K_trace;
+  const CCTK_REAL Gamma_x = b.Gamma.dx;
+  const CCTK_REAL Gamma_y = b.Gamma.dy;
+  const CCTK_REAL Gamma_z = b.Gamma.dz;
+  const CCTK_REAL d_x_alp = b.d_alp.dx;
+  const CCTK_REAL d_y_alp = b.d_alp.dy;
+  const CCTK_REAL d_z_alp = b.d_alp.dz;
+  const CCTK_REAL d_x_Phi = d_Phi.dx;
+  const CCTK_REAL d_y_Phi = d_Phi.dy;
+  const CCTK_REAL d_z_Phi = d_Phi.dz;
+  const CCTK_REAL d_xx_Phi = dd_Phi.dxx;
+  const CCTK_REAL d_xy_Phi = dd_Phi.dxy;
+  const CCTK_REAL d_xz_Phi = dd_Phi.dxz;
+  const CCTK_REAL d_yy_Phi = dd_Phi.dyy;
+  const CCTK_REAL d_yz_Phi = dd_Phi.dyz;
+  const CCTK_REAL d_zz_Phi = dd_Phi.dzz;
+  const CCTK_REAL d_x_K_Phi = d_K_Phi.dx;
+  const CCTK_REAL d_y_K_Phi = d_K_Phi.dy;
+  const CCTK_REAL d_z_K_Phi = d_K_Phi.dz;
+
+  const CCTK_REAL result
+      = -0.5 * alpL
+          * (-Gamma_x * d_x_Phi - Gamma_y * d_y_Phi - Gamma_z * d_z_Phi - 2 * K_PhiL * K_trace
+             - PhiL * field_mass * field_mass + d_xx_Phi * igxx + 2 * d_xy_Phi * igxy
+             + 2 * d_xz_Phi * igxz + d_yy_Phi * igyy + 2 * d_yz_Phi * igyz + d_zz_Phi * igzz)
+        + betaxL * d_x_K_Phi + betayL * d_y_K_Phi + betazL * d_z_K_Phi
+        - 0.5 * d_x_alp * (d_x_Phi * igxx + d_y_Phi * igxy + d_z_Phi * igxz)
+        - 0.5 * d_y_alp * (d_x_Phi * igxy + d_y_Phi * igyy + d_z_Phi * igyz)
+        - 0.5 * d_z_alp * (d_x_Phi * igxz + d_y_Phi * igyz + d_z_Phi * igzz);
+  return result;
+}
+
+/* Wave operator of a static background in patch local coordinates */
+inline local_operator to_local(const background &b, CCTK_REAL alpL, const global_gradient &beta,
+                               const jacobian &J, const jacobian_derivatives &dJ) {
+  const CCTK_REAL igxx = b.ig.xx;
+  const CCTK_REAL igxy = b.ig.xy;
+  const CCTK_REAL igxz = b.ig.xz;
+  const CCTK_REAL igyy = b.ig.yy;
+  const CCTK_REAL igyz = b.ig.yz;
+  const CCTK_REAL igzz = b.ig.zz;
+  const CCTK_REAL K_trace = b.K_trace;
+  const CCTK_REAL Gamma_x = b.Gamma.dx;
+  const CCTK_REAL Gamma_y = b.Gamma.dy;
+  const CCTK_REAL Gamma_z = b.Gamma.dz;
+  const CCTK_REAL d_x_alp = b.d_alp.dx;
+  const CCTK_REAL d_y_alp = b.d_alp.dy;
+  const CCTK_REAL d_z_alp = b.d_alp.dz;
+  const CCTK_REAL betaxL = beta.dx;
+  const CCTK_REAL betayL = beta.dy;
+  const CCTK_REAL betazL = beta.dz;
+  const CCTK_REAL J11 = J.J11;
+  const CCTK_REAL J12 = J.J12;
+  const CCTK_REAL J13 = J.J13;
+  const CCTK_REAL J21 = J.J21;
+  const CCTK_REAL J22 = J.J22;
+  const CCTK_REAL J23 = J.J23;
+  const CCTK_REAL J31 = J.J31;
+  const CCTK_REAL J32 = J.J32;
+  const CCTK_REAL J33 = J.J33;
+  const CCTK_REAL dJ111 = dJ.J111;
+  const CCTK_REAL dJ112 = dJ.J112;
+  const CCTK_REAL dJ113 = dJ.J113;
+  const CCTK_REAL dJ122 = dJ.J122;
+  const CCTK_REAL dJ123 = dJ.J123;
+  const CCTK_REAL dJ133 = dJ.J133;
+  const CCTK_REAL dJ211 = dJ.J211;
+  const CCTK_REAL dJ212 = dJ.J212;
+  const CCTK_REAL dJ213 = dJ.J213;
+  const CCTK_REAL dJ222 = dJ.J222;
+  const CCTK_REAL dJ223 = dJ.J223;
+  const CCTK_REAL dJ233 = dJ.J233;
+  const CCTK_REAL dJ311 = dJ.J311;
+  const CCTK_REAL dJ312 = dJ.J312;
+  const CCTK_REAL dJ313 = dJ.J313;
+  const CCTK_REAL dJ322 = dJ.J322;
+  const CCTK_REAL dJ323 = dJ.J323;
+  const CCTK_REAL dJ333 = dJ.J333;
+
+  const CCTK_REAL t0 = J11 * igxx + J12 * igxy + J13 * igxz;
+  const CCTK_REAL t1 = J11 * igxy + J12 * igyy + J13 * igyz;
+  const CCTK_REAL t2 = J11 * igxz + J12 * igyz + J13 * igzz;
+  const CCTK_REAL t3 = J21 * igxx + J22 * igxy + J23 * igxz;
+  const CCTK_REAL t4 = J21 * igxy + J22 * igyy + J23 * igyz;
+  const CCTK_REAL t5 = J21 * igxz + J22 * igyz + J23 * igzz;
+  const CCTK_REAL t6 = J31 * igxx + J32 * igxy + J33 * igxz;
+  const CCTK_REAL t7 = J31 * igxy + J32 * igyy + J33 * igyz;
+  const CCTK_REAL t8 = J31 * igxz + J32 * igyz + J33 * igzz;
+  const CCTK_REAL t9 = 2 * igxy;
+  const CCTK_REAL t10 = 2 * igxz;
+  const CCTK_REAL t11 = 2 * igyz;
+
+  const CCTK_REAL G_aa = alpL * (J11 * t0 + J12 * t1 + J13 * t2);
+  const CCTK_REAL G_ab = alpL * (J21 * t0 + J22 * t1 + J23 * t2);
+  const CCTK_REAL G_ac = alpL * (J31 * t0 + J32 * t1 + J33 * t2);
+  const CCTK_REAL G_bb = alpL * (J21 * t3 + J22 * t4 + J23 * t5);
+  const CCTK_REAL G_bc = alpL * (J31 * t3 + J32 * t4 + J33 * t5);
+  const CCTK_REAL G_cc = alpL * (J31 * t6 + J32 * t7 + J33 * t8);
+  const CCTK_REAL u_a
+      = -0.5 * alpL
+          * (-Gamma_x * J11 - Gamma_y * J12 - Gamma_z * J13 + dJ111 * igxx + dJ112 * t9
+             + dJ113 * t10 + dJ122 * igyy + dJ123 * t11 + dJ133 * igzz)
+        - 0.5 * d_x_alp * t0 - 0.5 * d_y_alp * t1 - 0.5 * d_z_alp * t2;
+  const CCTK_REAL u_b
+      = -0.5 * alpL
+          * (-Gamma_x * J21 - Gamma_y * J22 - Gamma_z * J23 + dJ211 * igxx + dJ212 * t9
+             + dJ213 * t10 + dJ222 * igyy + dJ223 * t11 + dJ233 * igzz)
+        - 0.5 * d_x_alp * t3 - 0.5 * d_y_alp * t4 - 0.5 * d_z_alp * t5;
+  const CCTK_REAL u_c
+      = -0.5 * alpL
+          * (-Gamma_x * J31 - Gamma_y * J32 - Gamma_z * J33 + dJ311 * igxx + dJ312 * t9
+             + dJ313 * t10 + dJ322 * igyy + dJ323 * t11 + dJ333 * igzz)
+        - 0.5 * d_x_alp * t6 - 0.5 * d_y_alp * t7 - 0.5 * d_z_alp * t8;
+  const CCTK_REAL beta_a = J11 * betaxL + J12 * betayL + J13 * betazL;
+  const CCTK_REAL beta_b = J21 * betaxL + J22 * betayL + J23 * betazL;
+  const CCTK_REAL beta_c = J31 * betaxL + J32 * betayL + J33 * betazL;
+  const CCTK_REAL alp_K = K_trace * alpL;
+
+  return {G_aa, G_ab, G_ac, G_bb, G_bc, G_cc, u_a, u_b, u_c, beta_a, beta_b, beta_c, alp_K};
+}
+
+/* K_Phi right hand side at one point, from the patch-local operator */
+inline CCTK_REAL K_Phi_rhs_local(const local_operator &op, CCTK_REAL alpL, CCTK_REAL PhiL,
+                                 CCTK_REAL K_PhiL, const local_derivatives &l_Phi,
+                                 const local_gradient &l_K_Phi, CCTK_REAL field_mass) {
+  const CCTK_REAL G_aa = op.G.aa;
+  const CCTK_REAL G_ab = op.G.ab;
+  const CCTK_REAL G_ac = op.G.ac;
+  const CCTK_REAL G_bb = op.G.bb;
+  const CCTK_REAL G_bc = op.G.bc;
+  const CCTK_REAL G_cc = op.G.cc;
+  const CCTK_REAL u_a = op.u.a;
+  const CCTK_REAL u_b = op.u.b;
+  const CCTK_REAL u_c = op.u.c;
+  const CCTK_REAL beta_a = op.beta.a;
+  const CCTK_REAL beta_b = op.beta.b;
+  const CCTK_REAL beta_c = op.beta.c;
+  const CCTK_REAL alp_K = op.alp_K;
+  const CCTK_REAL d_a_Phi = l_Phi.d.da;
+  const CCTK_REAL d_b_Phi = l_Phi.d.db;
+  const CCTK_REAL d_c_Phi = l_Phi.d.dc;
+  const CCTK_REAL d_aa_Phi = l_Phi.daa;
+  const CCTK_REAL d_ab_Phi = l_Phi.dab;
+  const CCTK_REAL d_ac_Phi = l_Phi.dac;
+  const CCTK_REAL d_bb_Phi = l_Phi.dbb;
+  const CCTK_REAL d_bc_Phi = l_Phi.dbc;
+  const CCTK_REAL d_cc_Phi = l_Phi.dcc;
+  const CCTK_REAL d_a_K_Phi = l_K_Phi.da;
+  const CCTK_REAL d_b_K_Phi = l_K_Phi.db;
+  const CCTK_REAL d_c_K_Phi = l_K_Phi.dc;
+
+  const CCTK_REAL result
+      = -0.5 * G_aa * d_aa_Phi - G_ab * d_ab_Phi - G_ac * d_ac_Phi - 0.5 * G_bb * d_bb_Phi
+        - G_bc * d_bc_Phi - 0.5 * G_cc * d_cc_Phi + K_PhiL * alp_K
+        + 0.5 * PhiL * alpL * field_mass * field_mass + beta_a * d_a_K_Phi + beta_b * d_b_K_Phi
+        + beta_c * d_c_K_Phi + d_a_Phi * u_a + d_b_Phi * u_b + d_c_Phi * u_c;
+  return result;
+}
+
+} // namespace kg
+
+#endif /* GENERATED_HPP */
@@ -0,0 +1,272 @@
+/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  Initialize.cpp
+ *  Initialize grid variables. The analytic solutions are shared with
+ *  FCKleinGordon through AnalyticSolutions.hpp.
+ */
+
+/*************************
+ * This thorn's includes *
+ *************************/
+#include "AnalyticSolutions.hpp"
+#include "FileInitialData.hpp"
+#include "KleinGordon.h"
+#include "Simd.hpp"
+
+/**************************
+ * C++ std. lib. includes *
+ **************************/
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+/**
+ * A constant number that represents a small value. If reals are smaller than
+ * this threshold, they are taken to be zero.
+ */
+const CCTK_REAL smallnes_threshold = 1.0e-8;
+
+/**
+ * Compute the angular part of the multipolar gaussian function at a given cartesian point.
+ *
+ * The azimuth of points with x < 0 is shifted by pi and the azimuth of points with x = 0 is pi / 2,
+ * as in previous versions of this thorn, so that existing initial data is reproduced.
+ *
+ * @param multipole_array The coefficients of the multipole series, indexed by l * l + l + m.
+ * @param Y A scratch buffer with (lmax + 1)^2 entries.
+ * @param lmax The maximun value of l that will be computed.
+ * @param x The x cartesian coordinate.
+ * @param y The y cartesian coordiante.
+ * @param z The z cartesian coordinate.
+ * @param R The distance to the origin.
+ * @return The value of the multipole series.
+ */
+CCTK_REAL multipolar_angular_factor(const CCTK_REAL *multipole_array, CCTK_REAL *Y, CCTK_INT lmax,
+                                    CCTK_REAL x, CCTK_REAL y, CCTK_REAL z, CCTK_REAL R) {
+  const CCTK_REAL cos_theta = z / std::max(R, smallnes_threshold);
+
+  const CCTK_REAL phi = x == 0 ? M_PI / 2 : std::atan2(y, x) + (x < 0 ? M_PI : 0.0);
+
+  return analytic::multipole_series<CCTK_REAL>(lmax, multipole_array, cos_theta, phi, Y);
+}
+
+/**
+ * Whether the k lines of the component are radial lines through the pulse centre, such as those
+ * of Llama's angular patches when the pulse is centred at the patch centre. The four corner lines
+ * and the central line are sampled, comparing the directions of their end points.
+ *
+ * @param cctkGH The Cactus grid hierarchy.
+ * @param x The x coordinates of the component.
+ * @param y The y coordinates of the component.
+ * @param z The z coordinates of the component.
+ * @param x0 The x coordinate of the pulse centre.
+ * @param y0 The y coordinate of the pulse centre.
+ * @param z0 The z coordinate of the pulse centre.
+ * @param tolerance The largest difference between the unit vectors of the end points.
+ * @return True if every sampled line keeps its direction.
+ */
+bool radial_k_lines(const cGH *cctkGH, const CCTK_REAL *x, const CCTK_REAL *y, const CCTK_REAL *z,
+                    CCTK_REAL x0, CCTK_REAL y0, CCTK_REAL z0, CCTK_REAL tolerance) {
+  const CCTK_INT ni = cctkGH->cctk_lsh[0], nj = cctkGH->cctk_lsh[1], nk = cctkGH->cctk_lsh[2];
+
+  if (nk < 2)
+    return false;
+
+  const CCTK_INT lines[5][2]
+      = {{0, 0}, {ni - 1, 0}, {0, nj - 1}, {ni - 1, nj - 1}, {ni / 2, nj / 2}};
+
+  for (const auto &line : lines) {
+    const CCTK_INT first = CCTK_GFINDEX3D(cctkGH, line[0], line[1], 0);
+    const CCTK_INT last = CCTK_GFINDEX3D(cctkGH, line[0], line[1], nk - 1);
+
+    const CCTK_REAL R_first
+        = std::sqrt((x[first] - x0) * (x[first] - x0) + (y[first] - y0) * (y[first] - y0)
+                    + (z[first] - z0) * (z[first] - z0));
+    const CCTK_REAL R_last
+        = std::sqrt((x[last] - x0) * (x[last] - x0) + (y[last] - y0) * (y[last] - y0)
+                    + (z[last] - z0) * (z[last] - z0));
+
+    if (R_first < smallnes_threshold || R_last < smallnes_threshold)
+      return false;
+
+    if (std::fabs((x[first] - x0) / R_first - (x[last] - x0) / R_last) > tolerance
+        || std::fabs((y[first] - y0) / R_first - (y[last] - y0) / R_last) > tolerance
+        || std::fabs((z[first] - z0) / R_first - (z[last] - z0) / R_last) > tolerance)
+      return false;
+  }
+
+  return true;
+}
+
+} // namespace
+
+void KleinGordon_Initialize(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS;
+  DECLARE_CCTK_PARAMETERS;
+
+  if (CCTK_EQUALS(initial_data, "multipolar_gaussian")) {
+
+    const CCTK_INT lmax = multipoles_lmax;
+
+    /* Sets Phi and K_Phi at ijk, at the displacement (dx, dy, dz) from the pulse centre */
+    const auto set_point = [&](CCTK_INT ijk, CCTK_REAL angular, CCTK_REAL dx, CCTK_REAL dy,
+                               CCTK_REAL dz, CCTK_REAL R) {
+      const analytic::radial_profile<CCTK_REAL> shell
+          = analytic::gaussian_shell(R, gaussian_R0, gaussian_sigma);
+
+      const CCTK_REAL gaussian = angular * shell.G;
+      const CCTK_REAL gaussian_dr = angular * shell.d_R_G;
+
+      CCTK_REAL contraction = (betax[ijk] * dx + betay[ijk] * dy + betaz[ijk] * dz);
+
+      if (contraction < 1.0e-13)
+        contraction = 0.0;
+      else
+        contraction /= R;
+
+      Phi[ijk] = gaussian;
+
+      // This choice makes the gaussian move towards the origin, instead of splitting.
+      K_Phi[ijk] = ((contraction - 1.0) * gaussian_dr) / (2 * alp[ijk]);
+    };
+
+    /* Points sharing the same direction from the pulse centre share the angular factor. When
+     * the k lines of the component are radial, as on Llama's angular patches with the pulse at
+     * the patch centre, they are swept along k and the last factor is reused while the direction
+     * does not change. Otherwise there is nothing to reuse, and i is kept innermost. */
+    const CCTK_REAL same_direction_tolerance = 1.0e-12;
+
+    if (radial_k_lines(cctkGH, x, y, z, gaussian_x0, gaussian_y0, gaussian_z0,
+                       same_direction_tolerance)) {
+#pragma omp parallel
+      {
+        /* Per thread scratch space for the spherical harmonics */
+        std::vector<CCTK_REAL> Y_lm((lmax + 1) * (lmax + 1));
+
+#pragma omp for collapse(2)
+        for (CCTK_INT j = 0; j < cctk_lsh[1]; j++) {
+          for (CCTK_INT i = 0; i < cctk_lsh[0]; i++) {
+            bool have_angular = false;
+            CCTK_REAL angular = 0.0, nx = 0.0, ny = 0.0, nz = 0.0;
+
+            for (CCTK_INT k = 0; k < cctk_lsh[2]; k++) {
+              const CCTK_INT ijk = CCTK_GFINDEX3D(cctkGH, i, j, k);
+
+              const CCTK_REAL dx = x[ijk] - gaussian_x0;
+              const CCTK_REAL dy = y[ijk] - gaussian_y0;
+              const CCTK_REAL dz = z[ijk] - gaussian_z0;
+
+              const CCTK_REAL R = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+              if (R < smallnes_threshold) {
+                angular = multipolar_angular_factor(multipoles, Y_lm.data(), lmax, dx, dy, dz, R);
+                have_angular = false;
+              } else if (!have_angular || std::fabs(dx / R - nx) > same_direction_tolerance
+                         || std::fabs(dy / R - ny) > same_direction_tolerance
+                         || std::fabs(dz / R - nz) > same_direction_tolerance) {
+                angular = multipolar_angular_factor(multipoles, Y_lm.data(), lmax, dx, dy, dz, R);
+                nx = dx / R;
+                ny = dy / R;
+                nz = dz / R;
+                have_angular = true;
+              }
+
+              set_point(ijk, angular, dx, dy, dz, R);
+            }
+          }
+        }
+      }
+    } else {
+#pragma omp parallel
+      {
+        /* Per thread scratch space for the spherical harmonics */
+        std::vector<CCTK_REAL> Y_lm((lmax + 1) * (lmax + 1));
+
+#pragma omp for collapse(2)
+        for (CCTK_INT k = 0; k < cctk_lsh[2]; k++) {
+          for (CCTK_INT j = 0; j < cctk_lsh[1]; j++) {
+            for (CCTK_INT i = 0; i < cctk_lsh[0]; i++) {
+              const CCTK_INT ijk = CCTK_GFINDEX3D(cctkGH, i, j, k);
+
+              const CCTK_REAL dx = x[ijk] - gaussian_x0;
+              const CCTK_REAL dy = y[ijk] - gaussian_y0;
+              const CCTK_REAL dz = z[ijk] - gaussian_z0;
+
+              const CCTK_REAL R = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+              set_point(ijk,
+                        multipolar_angular_factor(multipoles, Y_lm.data(), lmax, dx, dy, dz, R),
+                        dx, dy, dz, R);
+            }
+          }
+        }
+      }
+    }
+
+  } else if (CCTK_EQUALS(initial_data, "exact_gaussian")) {
+
+#pragma omp parallel for collapse(2)
+    for (CCTK_INT k = 0; k < cctk_lsh[2]; k++) {
+      for (CCTK_INT j = 0; j < cctk_lsh[1]; j++) {
+        kg::simd_row(0, cctk_lsh[0], [&](CCTK_INT i) {
+          const CCTK_INT ijk = CCTK_GFINDEX3D(cctkGH, i, j, k);
+
+          /* Since this initial data represents a exact solution of the field equations
+           * in a flat background, we will assume that the lapse is one and the
+           * shift is zero in the equations below
+           */
+          const analytic::wave_state<CCTK_REAL> s = analytic::exact_gaussian(
+              0.0, x[ijk] - gaussian_x0, y[ijk] - gaussian_y0, z[ijk] - gaussian_z0, 1.0,
+              gaussian_sigma);
+
+          Phi[ijk] = s.Phi;
+          K_Phi[ijk] = -0.5 * s.d_t_Phi;
+        });
+      }
+    }
+
+  } else if (CCTK_EQUALS(initial_data, "plane_wave")) {
+
+#pragma omp parallel for collapse(2)
+    for (CCTK_INT k = 0; k < cctk_lsh[2]; k++) {
+      for (CCTK_INT j = 0; j < cctk_lsh[1]; j++) {
+        kg::simd_row(0, cctk_lsh[0], [&](CCTK_INT i) {
+          const CCTK_INT ijk = CCTK_GFINDEX3D(cctkGH, i, j, k);
+
+          const analytic::wave_state<CCTK_REAL> s = analytic::plane_wave(
+              time_offset, x[ijk] - space_offset[0], y[ijk] - space_offset[1],
+              z[ijk] - space_offset[2], wave_number[0], wave_number[1], wave_number[2]);
+
+          /* Since this initial data is intended to be used as a test in flat background,
+           * we assume that the lapse is 1 on the equations below. K_Phi keeps the sign
+           * of previous versions of this thorn, which evolves the wave against wave_number
+           */
+          Phi[ijk] = s.Phi;
+          K_Phi[ijk] = 0.5 * s.d_t_Phi;
+        });
+      }
+    }
+
+  } else if (CCTK_EQUALS(initial_data, "from_file")) {
+    kg::initialize_from_file(CCTK_PASS_CTOC);
+  }
+}
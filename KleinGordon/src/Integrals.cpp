@@ -0,0 +1,50 @@
+/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  Integrals.cpp
+ *  Process local accumulation and reduction of the volume integrals.
+ */
+
+/*************************
+ * This thorn's includes *
+ *************************/
+#include "Integrals.hpp"
+#include "KleinGordon.h"
+#include "Reductions.hpp"
+
+namespace {
+
+/* Process local total energy of each refinement level */
+reduction::per_level<CCTK_REAL> level_energy;
+
+} // namespace
+
+void kg::add_to_total_energy(const cGH *cctkGH, CCTK_REAL energy) {
+  level_energy.current(cctkGH) += energy;
+}
+
+extern "C" void KleinGordon_ReduceTotalEnergy(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS;
+
+  CCTK_REAL &energy = level_energy.current(cctkGH);
+
+  reduction::reduce(cctkGH, "sum", &energy, total_energy, 1, "the total energy");
+
+  energy = 0.0;
+}
@@ -0,0 +1,38 @@
+/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  Integrals.hpp
+ *  Proper volume integrals over the grid hierarchy, accumulated by the
+ *  kernels component by component and reduced once per refinement level.
+ *  The points are weighted by reduction::get_volume_weights.
+ */
+
+#ifndef INTEGRALS_HPP
+#define INTEGRALS_HPP
+
+#include "cctk.h"
+
+namespace kg {
+
+/* Adds the contribution of the current component to the total energy of its level */
+void add_to_total_energy(const cGH *cctkGH, CCTK_REAL energy);
+
+} // namespace kg
+
+#endif /* INTEGRALS_HPP */
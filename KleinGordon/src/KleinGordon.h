@@ -31,6 +31,10 @@
 #include "cctk_Arguments.h"
 #include "cctk_Parameters.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /**************************************************
  * KleinGordon_Startup(void)                      *
  *                                                *
@@ -125,133 +129,119 @@ void KleinGordon_ZeroError(CCTK_ARGUMENTS);
 void KleinGordon_ZeroEnDen(CCTK_ARGUMENTS);
 
 /**********************************************
- * KleinGordon_RHS_4(CCTK_ARGUMENTS)          *
- *                                            *
- * This function computes the right hand side *
- * of the ADM scalar wave equation.           *
- *                                            *
- * Input: CCTK_ARGUMENTS (the grid functions  *
- * from interface.ccl                         *
- *                                            *
- * Output: Nothing                            *
- **********************************************/
-void KleinGordon_RHS_4(CCTK_ARGUMENTS);
-
-/**********************************************
- * KleinGordon_RHS_6(CCTK_ARGUMENTS)          *
+ * KleinGordon_RHS(CCTK_ARGUMENTS)            *
  *                                            *
  * This function computes the right hand side *
- * of the ADM scalar wave equation.           *
+ * of the ADM scalar wave equation using      *
+ * fd_order accurate finite differences.      *
  *                                            *
  * Input: CCTK_ARGUMENTS (the grid functions  *
  * from interface.ccl                         *
  *                                            *
  * Output: Nothing                            *
  **********************************************/
-void KleinGordon_RHS_6(CCTK_ARGUMENTS);
+void KleinGordon_RHS(CCTK_ARGUMENTS);
 
-/**********************************************
- * KleinGordon_RHS_8(CCTK_ARGUMENTS)          *
- *                                            *
- * This function computes the right hand side *
- * of the ADM scalar wave equation.           *
- *                                            *
- * Input: CCTK_ARGUMENTS (the grid functions  *
- * from interface.ccl                         *
- *                                            *
- * Output: Nothing                            *
- **********************************************/
-void KleinGordon_RHS_8(CCTK_ARGUMENTS);
+/**************************************************
+ * KleinGordon_CalcBackground(CCTK_ARGUMENTS)     *
+ *                                                *
+ * This function computes the inverse metric, the *
+ * trace of the extrinsic curvature, the          *
+ * contracted Christoffel symbols and the lapse   *
+ * gradient of a static background and stores     *
+ * them in background_group.                      *
+ *                                                *
+ * Input: CCTK_ARGUMENTS (the grid functions from *
+ * interface.ccl                                  *
+ *                                                *
+ * Output: Nothing                                *
+ **************************************************/
+void KleinGordon_CalcBackground(CCTK_ARGUMENTS);
 
-/***********************************************
- * KleinGordon_CalcTmunu_4(CCTK_ARGUMENTS)     *
- *                                             *
- * This function computes the energy momentum  *
- * tensor of the scalar field using 4-th order *
- * accurate finite differences.                *
- * of the ADM scalar wave equation.            *
- *                                             *
- * Input: CCTK_ARGUMENTS (the grid functions   *
- * from interface.ccl                          *
- *                                             *
- * Output: Nothing                             *
- ***********************************************/
-void KleinGordon_CalcTmunu_4(CCTK_ARGUMENTS);
+/**************************************************
+ * KleinGordon_CalcLocalOperator(CCTK_ARGUMENTS)  *
+ *                                                *
+ * This function computes the wave operator of a  *
+ * static background in patch local coordinates   *
+ * and stores it in local_operator_group.         *
+ *                                                *
+ * Input: CCTK_ARGUMENTS (the grid functions from *
+ * interface.ccl                                  *
+ *                                                *
+ * Output: Nothing                                *
+ **************************************************/
+void KleinGordon_CalcLocalOperator(CCTK_ARGUMENTS);
 
-/***********************************************
- * KleinGordon_CalcTmunu_6(CCTK_ARGUMENTS)     *
- *                                             *
- * This function computes the energy momentum  *
- * tensor of the scalar field using 6-th order *
- * accurate finite differences.                *
- * of the ADM scalar wave equation.            *
- *                                             *
- * Input: CCTK_ARGUMENTS (the grid functions   *
- * from interface.ccl                          *
- *                                             *
- * Output: Nothing                             *
- ***********************************************/
-void KleinGordon_CalcTmunu_6(CCTK_ARGUMENTS);
+/****************************************************
+ * KleinGordon_ClearBackgroundCache(CCTK_ARGUMENTS) *
+ *                                                  *
+ * This function invalidates every component of    *
+ * background_group, forcing it to be recomputed by *
+ * the next RHS evaluation.                         *
+ *                                                  *
+ * Input: CCTK_ARGUMENTS (the grid functions from   *
+ * interface.ccl                                    *
+ *                                                  *
+ * Output: Nothing                                  *
+ ****************************************************/
+void KleinGordon_ClearBackgroundCache(CCTK_ARGUMENTS);
 
 /***********************************************
- * KleinGordon_CalcTmunu_8(CCTK_ARGUMENTS)     *
+ * KleinGordon_CalcTmunu(CCTK_ARGUMENTS)       *
  *                                             *
  * This function computes the energy momentum  *
- * tensor of the scalar field using 8-th order *
+ * tensor of the scalar field using fd_order   *
  * accurate finite differences.                *
- * of the ADM scalar wave equation.            *
  *                                             *
  * Input: CCTK_ARGUMENTS (the grid functions   *
  * from interface.ccl                          *
  *                                             *
  * Output: Nothing                             *
  ***********************************************/
-void KleinGordon_CalcTmunu_8(CCTK_ARGUMENTS);
+void KleinGordon_CalcTmunu(CCTK_ARGUMENTS);
 
 /***********************************************
- * KleinGordon_CalcEnDen_4(CCTK_ARGUMENTS)     *
+ * KleinGordon_CalcEnDen(CCTK_ARGUMENTS)       *
  *                                             *
  * This function computes the energy density   *
- * of the scalar field using 4-th order        *
+ * of the scalar field using fd_order          *
  * accurate finite differences.                *
- * of the ADM scalar wave equation.            *
  *                                             *
  * Input: CCTK_ARGUMENTS (the grid functions   *
  * from interface.ccl                          *
  *                                             *
  * Output: Nothing                             *
  ***********************************************/
-void KleinGordon_CalcEnDen_4(CCTK_ARGUMENTS);
+void KleinGordon_CalcEnDen(CCTK_ARGUMENTS);
 
 /***********************************************
- * KleinGordon_CalcEnDen_6(CCTK_ARGUMENTS)     *
+ * KleinGordon_CalcTotalEnergy(CCTK_ARGUMENTS) *
  *                                             *
- * This function computes the energy density   *
- * of the scalar field using 6-th order        *
- * accurate finite differences.                *
- * of the ADM scalar wave equation.            *
+ * This function integrates the energy density *
+ * of the scalar field over the proper volume  *
+ * of the local components without storing    *
+ * it.                                         *
  *                                             *
  * Input: CCTK_ARGUMENTS (the grid functions   *
  * from interface.ccl                          *
  *                                             *
  * Output: Nothing                             *
  ***********************************************/
-void KleinGordon_CalcEnDen_6(CCTK_ARGUMENTS);
+void KleinGordon_CalcTotalEnergy(CCTK_ARGUMENTS);
 
-/***********************************************
- * KleinGordon_CalcEnDen_8(CCTK_ARGUMENTS)     *
- *                                             *
- * This function computes the energy density   *
- * of the scalar field using 8-th order        *
- * accurate finite differences.                *
- * of the ADM scalar wave equation.            *
- *                                             *
- * Input: CCTK_ARGUMENTS (the grid functions   *
- * from interface.ccl                          *
- *                                             *
- * Output: Nothing                             *
- ***********************************************/
-void KleinGordon_CalcEnDen_8(CCTK_ARGUMENTS);
+/*************************************************
+ * KleinGordon_ReduceTotalEnergy(CCTK_ARGUMENTS) *
+ *                                               *
+ * This function reduces the total energy of the *
+ * current refinement level over all processes   *
+ * and stores it in total_energy_group.          *
+ *                                               *
+ * Input: CCTK_ARGUMENTS (the grid functions     *
+ * from interface.ccl                            *
+ *                                               *
+ * Output: Nothing                               *
+ *************************************************/
+void KleinGordon_ReduceTotalEnergy(CCTK_ARGUMENTS);
 
 /****************************************************************
  * KleinGordon_RHSSync(CCTK_ARGUMENTS)                          *
@@ -344,32 +334,37 @@ void KleinGordon_Boundaries(CCTK_ARGUMENTS);
  ****************************************************/
 void KleinGordon_Error(CCTK_ARGUMENTS);
 
-/**
- * The general Gaussian solution of the wave equation in Minkowski
- * spacetime - cartesian version.
- *
- * @param t The time which the solution is to be evaluated. *
- * @param x The x cartesian coordinate
- * @param y The y cartesian coordinate
- * @param z The z cartesian coordinate
- * @param sigma The Gaussian width.
- * @return The general solution of the wave equation in Minkowski spacetime.
- */
-CCTK_REAL cartesian_gaussian_solution(CCTK_REAL t, CCTK_REAL x, CCTK_REAL y, CCTK_REAL z,
-                                      CCTK_REAL sigma);
+/****************************************************
+ * KleinGordon_ErrorNorms(CCTK_ARGUMENTS)           *
+ *                                                  *
+ * This function accumulates the L1, L2 and Linf    *
+ * norms of the error of the solution with respect  *
+ * to the analytic gaussian pulse on the local      *
+ * components, without storing error_group.         *
+ *                                                  *
+ * Input: CCTK_ARGUMENTS (the grid functions        *
+ * from interface.ccl                               *
+ *                                                  *
+ * Output: Nothing                                  *
+ ****************************************************/
+void KleinGordon_ErrorNorms(CCTK_ARGUMENTS);
 
-/**
- * Time derivative of the general Gaussian solution of the wave equation in Minkowski
- * spacetime - cartesian version.
- *
- * @param t The time which the solution is to be evaluated. *
- * @param x The x cartesian coordinate
- * @param y The y cartesian coordinate
- * @param z The z cartesian coordinate
- * @param sigma The Gaussian width.
- * @return The time derivative of the general solution of the wave equation in Minkowski spacetime.
- */
-CCTK_REAL cartesian_gaussian_solution_dt(CCTK_REAL t, CCTK_REAL x, CCTK_REAL y, CCTK_REAL z,
-                                         CCTK_REAL sigma);
+/****************************************************
+ * KleinGordon_ReduceErrorNorms(CCTK_ARGUMENTS)     *
+ *                                                  *
+ * This function reduces the error norms of the     *
+ * current refinement level over all processes and  *
+ * stores them in error_norms_group.                *
+ *                                                  *
+ * Input: CCTK_ARGUMENTS (the grid functions        *
+ * from interface.ccl                               *
+ *                                                  *
+ * Output: Nothing                                  *
+ ****************************************************/
+void KleinGordon_ReduceErrorNorms(CCTK_ARGUMENTS);
+
+#ifdef __cplusplus
+}
+#endif
 
-#endif /* DERIVATIVES_H */
+#endif /* KLEINGORDON_H */
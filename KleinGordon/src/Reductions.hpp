@@ -0,0 +1,230 @@
+/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  Reductions.hpp
+ *  Process local sums of the scalars reduced once per refinement level,
+ *  such as error norms and volume integrals, and the weights of the points
+ *  in volume integrals. Kernels add the contribution
+ *  of each local component and a level mode routine reduces them over all
+ *  processes. Exported to other thorns as KleinGordonReductions.hpp.
+ *  Including thorns must use the aliased function GetRefinementLevel.
+ */
+
+#ifndef REDUCTIONS_HPP
+#define REDUCTIONS_HPP
+
+#include "cctk.h"
+#include "cctk_Functions.h"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace reduction {
+
+/**************************************************
+ * A value of type T for each refinement level,   *
+ * value initialized when the level is first      *
+ * accessed. Without Carpet there is one level.   *
+ **************************************************/
+template <typename T> class per_level {
+public:
+  T &current(const cGH *cctkGH) {
+    const CCTK_INT rl
+        = CCTK_IsFunctionAliased("GetRefinementLevel") ? GetRefinementLevel(cctkGH) : 0;
+    const auto l = static_cast<std::size_t>(rl);
+
+    if (levels.size() <= l)
+      levels.resize(l + 1, T{});
+
+    return levels[l];
+  }
+
+private:
+  std::vector<T> levels;
+};
+
+/* Reduces n process local values over all processes with the reduction operator op. what names
+ * the reduced quantity in error messages. */
+inline void reduce(const cGH *cctkGH, const char *op, const CCTK_REAL *local, CCTK_REAL *global,
+                   int n, const char *what) {
+  const int handle = CCTK_ReductionHandle(op);
+
+  if (handle < 0)
+    CCTK_VERROR("Reducing %s requires a \"%s\" reduction operator", what, op);
+
+  for (int m = 0; m < n; m++) {
+    if (CCTK_ReduceLocScalar(cctkGH, -1, handle, &local[m], &global[m], CCTK_VARIABLE_REAL))
+      CCTK_VERROR("Failed to reduce %s", what);
+  }
+}
+
+/**************************************************
+ * Weights of the points of a component in a      *
+ * volume integral. weight is CarpetReduce's mask *
+ * of the points owned by the component, zero on  *
+ * ghost, buffer and refined points. volume_form  *
+ * is Llama's coordinate volume element, which    *
+ * also splits the interpatch overlap regions     *
+ * between the patches. Either may be missing, in *
+ * which case every point has weight one and the  *
+ * volume element is 1 / |det(J)|.                *
+ **************************************************/
+struct volume_weights {
+  const CCTK_REAL *weight = nullptr;
+  const CCTK_REAL *volume_form = nullptr;
+
+  /* Coordinate volume of the point in units of the local cell volume. J is any Jacobian with
+   * members J11 to J33. */
+  template <typename jacobian>
+  CCTK_REAL volume_element(CCTK_INT ijk, const jacobian &J) const {
+    const CCTK_REAL w = weight ? weight[ijk] : 1.0;
+
+    if (volume_form)
+      return w * volume_form[ijk];
+
+    const CCTK_REAL detJ = J.J11 * (J.J22 * J.J33 - J.J23 * J.J32)
+                           - J.J12 * (J.J21 * J.J33 - J.J23 * J.J31)
+                           + J.J13 * (J.J21 * J.J32 - J.J22 * J.J31);
+
+    return w / std::fabs(detJ);
+  }
+};
+
+inline const CCTK_REAL *optional_variable(const cGH *cctkGH, const char *name) {
+  const int index = CCTK_VarIndex(name);
+  return index >= 0 ? static_cast<const CCTK_REAL *>(CCTK_VarDataPtrI(cctkGH, 0, index)) : nullptr;
+}
+
+inline volume_weights get_volume_weights(const cGH *cctkGH) {
+  return {optional_variable(cctkGH, "CarpetReduce::weight"),
+          optional_variable(cctkGH, "Coordinates::volume_form")};
+}
+
+/**************************************************
+ * Error norms                                    *
+ *                                                *
+ * Follow the CarpetReduce conventions: norm1 and *
+ * norm2 are averages over the weighted points    *
+ * and norm_inf is the maximum.                   *
+ **************************************************/
+struct norms {
+  CCTK_REAL norm1, norm2, norm_inf;
+};
+
+/* Sum of the weights and weighted sums of nvars error estimates */
+template <int nvars> struct norm_sums {
+  CCTK_REAL weight;
+  CCTK_REAL sum1[nvars], sum2[nvars], max[nvars];
+
+  void add(int v, CCTK_REAL s1, CCTK_REAL s2, CCTK_REAL m) {
+    sum1[v] += s1;
+    sum2[v] += s2;
+    max[v] = std::fmax(max[v], m);
+  }
+};
+
+/**************************************************
+ * Adds the error norms of the local component to *
+ * sums. errors(ijk) returns the nvars absolute   *
+ * errors at the point ijk. Points are weighted   *
+ * by CarpetReduce's mask, or without it the      *
+ * interior is counted. Whole rows are evaluated  *
+ * so that they vectorize, points with zero       *
+ * weight not contributing to any of the norms.   *
+ **************************************************/
+template <int nvars, typename F>
+void add_norms(const cGH *cctkGH, norm_sums<nvars> &sums, F &&errors) {
+  const CCTK_REAL *const weight = optional_variable(cctkGH, "CarpetReduce::weight");
+
+  const int *const lsh = cctkGH->cctk_lsh;
+  const int *const ghosts = cctkGH->cctk_nghostzones;
+
+  CCTK_REAL w_sum = 0.0;
+  CCTK_REAL sum1[nvars] = {}, sum2[nvars] = {}, sup[nvars] = {};
+
+#pragma omp parallel for collapse(2) reduction(+ : w_sum, sum1[:nvars], sum2[:nvars])         \
+    reduction(max : sup[:nvars])
+  for (CCTK_INT k = 0; k < lsh[2]; k++) {
+    for (CCTK_INT j = 0; j < lsh[1]; j++) {
+      const bool interior_jk = j >= ghosts[1] && j < lsh[1] - ghosts[1] && k >= ghosts[2]
+                               && k < lsh[2] - ghosts[2];
+
+      if (!weight && !interior_jk)
+        continue;
+
+#pragma omp simd reduction(+ : w_sum, sum1[:nvars], sum2[:nvars]) reduction(max : sup[:nvars])
+      for (CCTK_INT i = 0; i < lsh[0]; i++) {
+        const CCTK_INT ijk = CCTK_GFINDEX3D(cctkGH, i, j, k);
+
+        const bool interior_i = i >= ghosts[0] && i < lsh[0] - ghosts[0];
+        const CCTK_REAL w = weight ? weight[ijk] : (interior_i ? 1.0 : 0.0);
+
+        const std::array<CCTK_REAL, nvars> e = errors(ijk);
+
+        w_sum += w;
+
+        for (int v = 0; v < nvars; v++) {
+          const CCTK_REAL ev = w == 0.0 ? 0.0 : e[v];
+
+          sum1[v] += w * ev;
+          sum2[v] += w * ev * ev;
+          sup[v] = ev > sup[v] ? ev : sup[v];
+        }
+      }
+    }
+  }
+
+  sums.weight += w_sum;
+
+  for (int v = 0; v < nvars; v++)
+    sums.add(v, sum1[v], sum2[v], sup[v]);
+}
+
+template <int nvars>
+std::array<norms, nvars> reduce_norms(const cGH *cctkGH, const norm_sums<nvars> &sums) {
+  CCTK_REAL local_sums[1 + 2 * nvars], local_max[nvars];
+  CCTK_REAL global_sums[1 + 2 * nvars], global_max[nvars];
+
+  local_sums[0] = sums.weight;
+
+  for (int v = 0; v < nvars; v++) {
+    local_sums[1 + 2 * v] = sums.sum1[v];
+    local_sums[2 + 2 * v] = sums.sum2[v];
+    local_max[v] = sums.max[v];
+  }
+
+  reduce(cctkGH, "sum", local_sums, global_sums, 1 + 2 * nvars, "the error norms");
+  reduce(cctkGH, "maximum", local_max, global_max, nvars, "the error norms");
+
+  const CCTK_REAL iw = global_sums[0] > 0.0 ? 1.0 / global_sums[0] : 0.0;
+
+  std::array<norms, nvars> result;
+
+  for (int v = 0; v < nvars; v++)
+    result[v] = {global_sums[1 + 2 * v] * iw, std::sqrt(global_sums[2 + 2 * v] * iw),
+                 global_max[v]};
+
+  return result;
+}
+
+} // namespace reduction
+
+#endif /* REDUCTIONS_HPP */
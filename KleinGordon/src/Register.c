@@ -35,17 +35,20 @@ void KleinGordon_MoLRegister(CCTK_ARGUMENTS) {
   /*
    * The ADM variables must be set as "Save and restore" within MoL.
    * Save and restore variables are those that a thorn depends on but
-   * does not set or evolve.
+   * does not set or evolve. A static background never changes, so there
+   * is nothing to save or restore in that case.
    */
-  const CCTK_INT lapse_group_idx = CCTK_GroupIndex("ADMBase::lapse");
-  const CCTK_INT shift_group_idx = CCTK_GroupIndex("ADMBase::shift");
-  const CCTK_INT metric_group_idx = CCTK_GroupIndex("ADMBase::metric");
-  const CCTK_INT curv_group_idx = CCTK_GroupIndex("ADMBase::curv");
+  if (!static_background) {
+    const CCTK_INT lapse_group_idx = CCTK_GroupIndex("ADMBase::lapse");
+    const CCTK_INT shift_group_idx = CCTK_GroupIndex("ADMBase::shift");
+    const CCTK_INT metric_group_idx = CCTK_GroupIndex("ADMBase::metric");
+    const CCTK_INT curv_group_idx = CCTK_GroupIndex("ADMBase::curv");
 
-  ierr += MoLRegisterSaveAndRestoreGroup(lapse_group_idx);
-  ierr += MoLRegisterSaveAndRestoreGroup(shift_group_idx);
-  ierr += MoLRegisterSaveAndRestoreGroup(metric_group_idx);
-  ierr += MoLRegisterSaveAndRestoreGroup(curv_group_idx);
+    ierr += MoLRegisterSaveAndRestoreGroup(lapse_group_idx);
+    ierr += MoLRegisterSaveAndRestoreGroup(shift_group_idx);
+    ierr += MoLRegisterSaveAndRestoreGroup(metric_group_idx);
+    ierr += MoLRegisterSaveAndRestoreGroup(curv_group_idx);
+  }
 
   /**
    * The energy momentum tensor and error variables shoud be registered as "Constrained"
@@ -60,7 +63,8 @@ void KleinGordon_MoLRegister(CCTK_ARGUMENTS) {
     ierr += MoLRegisterConstrainedGroup(energy_tensor_group_idx);
   }
 
-  if (compute_error) {
+  /* With error_norms_only the error grid functions have no storage */
+  if (compute_error && !error_norms_only) {
     const CCTK_INT error_group_idx = CCTK_GroupIndex("KleinGordon::error_group");
     ierr += MoLRegisterConstrainedGroup(error_group_idx);
   }
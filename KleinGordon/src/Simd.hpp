@@ -0,0 +1,68 @@
+/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  Simd.hpp
+ *  Vectorized sweeps along the i direction. The row loop is compiled once
+ *  per instruction set and the best version for the host is selected by
+ *  the dynamic loader when the thorn is loaded.
+ */
+
+#ifndef SIMD_HPP
+#define SIMD_HPP
+
+#include "cctk.h"
+
+/**************************************************
+ * Function multiversioning                       *
+ *                                                *
+ * GCC on x86_64 Linux emits one clone of the     *
+ * function for each listed target plus an ifunc  *
+ * resolver picking among them at load time. On   *
+ * other compilers and platforms only the default *
+ * version is built.                              *
+ **************************************************/
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__)
+#define KG_TARGET_CLONES                                                                           \
+  __attribute__((target_clones("default", "sse4.2", "arch=haswell", "arch=skylake-avx512")))
+#else
+#define KG_TARGET_CLONES
+#endif
+
+/* The row body is inlined into every clone, so that it is compiled for the
+ * clone's instruction set and the loop can be vectorized */
+#if defined(__GNUC__)
+#define KG_FLATTEN __attribute__((flatten))
+#else
+#define KG_FLATTEN
+#endif
+
+namespace kg {
+
+/* Calls body(i) for i in [imin, imax), with the iterations mapped to
+ * vector lanes. body must not carry dependencies between iterations. */
+template <typename F>
+KG_TARGET_CLONES KG_FLATTEN void simd_row(CCTK_INT imin, CCTK_INT imax, F &&body) {
+#pragma omp simd
+  for (CCTK_INT i = imin; i < imax; i++)
+    body(i);
+}
+
+} // namespace kg
+
+#endif /* SIMD_HPP */
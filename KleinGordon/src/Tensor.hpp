@@ -0,0 +1,155 @@
+/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  Tensor.hpp
+ *  Header only 3+1 algebra on vectors and symmetric tensors of a single
+ *  point. All loops are unrolled at compile time. Exported to other thorns
+ *  as KleinGordonTensor.hpp.
+ */
+
+#ifndef TENSOR_HPP
+#define TENSOR_HPP
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace tensor {
+
+/**************************************************
+ * Storage                                        *
+ *                                                *
+ * Any aggregate with three members is a vector   *
+ * and any aggregate with six members is a        *
+ * symmetric tensor, stored as xx, xy, xz, yy, yz *
+ * and zz. This lets the thorns keep their own    *
+ * naming, e.g. kg::global_gradient and           *
+ * kg::symmetric3. vec3 and sym3 are provided for *
+ * code that has no types of its own.             *
+ **************************************************/
+template <typename T> struct vec3 {
+  T x, y, z;
+};
+
+template <typename T> struct sym3 {
+  T xx, xy, xz, yy, yz, zz;
+};
+
+/* Position of the (i, j) component in the storage order of a symmetric tensor */
+template <int i, int j> constexpr int symmetric_index() {
+  if constexpr (i > j)
+    return symmetric_index<j, i>();
+  else
+    return i * 3 - i * (i - 1) / 2 + (j - i);
+}
+
+template <int i, typename V> constexpr auto get(const V &v) {
+  const auto &[x, y, z] = v;
+  return std::get<i>(std::forward_as_tuple(x, y, z));
+}
+
+template <int i, int j, typename S> constexpr auto get(const S &s) {
+  const auto &[xx, xy, xz, yy, yz, zz] = s;
+  return std::get<symmetric_index<i, j>()>(std::forward_as_tuple(xx, xy, xz, yy, yz, zz));
+}
+
+/* Compile-time index, of the same type sum passes to its summand */
+template <int n> inline constexpr std::integral_constant<int, n> index{};
+
+template <typename F, int... n> constexpr auto sum(const F &f, std::integer_sequence<int, n...>) {
+  return (f(std::integral_constant<int, n>{}) + ...);
+}
+
+/* f(0) + f(1) + ... + f(N - 1), with the index passed as a compile-time constant */
+template <int N, typename F> constexpr auto sum(const F &f) {
+  return sum(f, std::make_integer_sequence<int, N>{});
+}
+
+/**************************************************
+ * Contractions                                   *
+ **************************************************/
+
+/* u^i v_i */
+template <typename U, typename V> constexpr auto dot(const U &u, const V &v) {
+  return sum<3>([&](auto i) { return get<i>(u) * get<i>(v); });
+}
+
+/* A^{ij} B_{ij} */
+template <typename A, typename B> constexpr auto contract(const A &a, const B &b) {
+  return sum<3>([&](auto i) {
+    return sum<3>([&](auto j) { return get<i, j>(a) * get<i, j>(b); });
+  });
+}
+
+/* S_{ij} u^i v^j */
+template <typename S, typename U, typename V>
+constexpr auto quadratic(const S &s, const U &u, const V &v) {
+  return sum<3>([&](auto i) {
+    return get<i>(u) * sum<3>([&](auto j) { return get<i, j>(s) * get<j>(v); });
+  });
+}
+
+/* S_{ij} v^j, returned as an R, which defaults to the type of v */
+template <typename R = void, typename S, typename V> constexpr auto mul(const S &s, const V &v) {
+  using result = std::conditional_t<std::is_void_v<R>, V, R>;
+
+  const auto row = [&](auto i) {
+    return sum<3>([&](auto j) { return get<i, j>(s) * get<j>(v); });
+  };
+
+  return result{row(index<0>), row(index<1>), row(index<2>)};
+}
+
+/**************************************************
+ * Determinant and inverse                        *
+ *                                                *
+ * Both come from the same cofactors, so asking   *
+ * for the two costs one division and no          *
+ * repeated products.                             *
+ **************************************************/
+template <typename S> struct inverse_result {
+  decltype(get<0, 0>(std::declval<S>())) det;
+  S inv;
+};
+
+template <typename S> constexpr auto det_and_inverse(const S &s) {
+  const auto &[xx, xy, xz, yy, yz, zz] = s;
+
+  const auto cxx = yy * zz - yz * yz;
+  const auto cxy = xz * yz - xy * zz;
+  const auto cxz = xy * yz - xz * yy;
+
+  const auto det = xx * cxx + xy * cxy + xz * cxz;
+  const auto idet = 1 / det;
+
+  return inverse_result<S>{det,
+                           {cxx * idet, cxy * idet, cxz * idet, (xx * zz - xz * xz) * idet,
+                            (xy * xz - xx * yz) * idet, (xx * yy - xy * xy) * idet}};
+}
+
+template <typename S> constexpr auto det(const S &s) {
+  const auto &[xx, xy, xz, yy, yz, zz] = s;
+  return xx * (yy * zz - yz * yz) + xy * (xz * yz - xy * zz) + xz * (xy * yz - xz * yy);
+}
+
+template <typename S> constexpr S inverse(const S &s) { return det_and_inverse(s).inv; }
+
+} // namespace tensor
+
+#endif /* TENSOR_HPP */
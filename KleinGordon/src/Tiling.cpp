@@ -0,0 +1,131 @@
+/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  Tiling.cpp
+ *  Online autotuning of the tile shapes used by the kernels.
+ */
+
+/*************************
+ * This thorn's includes *
+ *************************/
+#include "Tiling.hpp"
+
+#include <array>
+#include <limits>
+#include <map>
+#include <string>
+#include <tuple>
+
+namespace {
+
+/* Candidate (nj, nk) tile shapes of tiled_blocks. The last one sweeps full j-k planes. */
+constexpr std::array<kg::tile_shape, 9> block_candidates{{{4, 4},
+                                                          {8, 4},
+                                                          {8, 8},
+                                                          {16, 4},
+                                                          {16, 8},
+                                                          {16, 16},
+                                                          {32, 4},
+                                                          {32, 8},
+                                                          {std::numeric_limits<CCTK_INT>::max(), 1}}};
+
+/* Candidate widths of the tiles of tiled_columns, which sets their k extent itself. The last
+ * one sweeps full j-k planes. */
+constexpr std::array<kg::tile_shape, 5> column_candidates{
+    {{4, 0}, {8, 0}, {16, 0}, {32, 0}, {std::numeric_limits<CCTK_INT>::max(), 0}}};
+
+struct candidate_list {
+  const kg::tile_shape *shapes;
+  std::size_t size;
+};
+
+candidate_list candidates(bool columns) {
+  return columns ? candidate_list{column_candidates.data(), column_candidates.size()}
+                 : candidate_list{block_candidates.data(), block_candidates.size()};
+}
+
+/* Every candidate is timed this many times and the fastest run is kept, so
+ * that a single cold-cache call does not decide the outcome */
+constexpr int sweeps = 2;
+
+struct tuning_state {
+  int calls = 0;
+  std::array<double, block_candidates.size()> best_time{};
+  std::size_t selected = 0;
+};
+
+using tuning_key = std::tuple<std::string, int, int, int>;
+
+std::map<tuning_key, tuning_state> tuning_states;
+
+tuning_key make_key(const char *kernel, const cGH *cctkGH) {
+  return {kernel, cctkGH->cctk_lsh[0], cctkGH->cctk_lsh[1], cctkGH->cctk_lsh[2]};
+}
+
+} // namespace
+
+kg::tile_shape kg::next_tile_shape(const char *kernel, const cGH *cctkGH, bool columns,
+                                   bool &timed) {
+  const tuning_state &state = tuning_states[make_key(kernel, cctkGH)];
+  const candidate_list list = candidates(columns);
+
+  const int total = static_cast<int>(list.size) * sweeps;
+
+  if (state.calls < total) {
+    timed = true;
+    return list.shapes[state.calls % list.size];
+  }
+
+  timed = false;
+  return list.shapes[state.selected];
+}
+
+void kg::report_tile_time(const char *kernel, const cGH *cctkGH, bool columns, double seconds) {
+  tuning_state &state = tuning_states[make_key(kernel, cctkGH)];
+  const candidate_list list = candidates(columns);
+
+  const std::size_t candidate = state.calls % list.size;
+
+  if (state.calls < static_cast<int>(list.size) || seconds < state.best_time[candidate])
+    state.best_time[candidate] = seconds;
+
+  state.calls++;
+
+  if (state.calls == static_cast<int>(list.size) * sweeps) {
+    for (std::size_t n = 1; n < list.size; n++) {
+      if (state.best_time[n] < state.best_time[state.selected])
+        state.selected = n;
+    }
+
+    const tile_shape &best = list.shapes[state.selected];
+
+    if (best.nj == std::numeric_limits<CCTK_INT>::max()) {
+      CCTK_VINFO("%s on a %dx%dx%d component: sweeping full j-k planes", kernel,
+                 cctkGH->cctk_lsh[0], cctkGH->cctk_lsh[1], cctkGH->cctk_lsh[2]);
+    } else if (columns) {
+      CCTK_VINFO("%s on a %dx%dx%d component: using %d j point wide columns", kernel,
+                 cctkGH->cctk_lsh[0], cctkGH->cctk_lsh[1], cctkGH->cctk_lsh[2],
+                 static_cast<int>(best.nj));
+    } else {
+      CCTK_VINFO("%s on a %dx%dx%d component: using %dx%d j-k tiles", kernel, cctkGH->cctk_lsh[0],
+                 cctkGH->cctk_lsh[1], cctkGH->cctk_lsh[2], static_cast<int>(best.nj),
+                 static_cast<int>(best.nk));
+    }
+  }
+}
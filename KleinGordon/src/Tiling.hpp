@@ -0,0 +1,184 @@
+/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  Tiling.hpp
+ *  Cache blocked traversal of the grid interior. The j-k plane is split
+ *  into tiles that are handed to the OpenMP threads dynamically, with the
+ *  i direction always traversed in full and innermost.
+ */
+
+#ifndef TILING_HPP
+#define TILING_HPP
+
+#include "cctk.h"
+
+#include <algorithm>
+#include <chrono>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace kg {
+
+/* Number of j and k points in a tile */
+struct tile_shape {
+  CCTK_INT nj, nk;
+};
+
+/* Index ranges [min, max) covered by one tile */
+struct tile {
+  CCTK_INT imin, imax;
+  CCTK_INT jmin, jmax;
+  CCTK_INT kmin, kmax;
+};
+
+/**************************************************
+ * Tile shape autotuning                          *
+ *                                                *
+ * For each kernel and component shape the        *
+ * candidate tile shapes are timed over the first *
+ * calls, after which the fastest one is used.    *
+ * next_tile_shape returns the shape to use in    *
+ * the next call and whether it is being timed.   *
+ * report_tile_time feeds back the measurement.   *
+ * With columns set only the tile width in j is   *
+ * tuned, for tiled_columns.                      *
+ **************************************************/
+tile_shape next_tile_shape(const char *kernel, const cGH *cctkGH, bool columns, bool &timed);
+
+void report_tile_time(const char *kernel, const cGH *cctkGH, bool columns, double seconds);
+
+/* Calls body(const tile &) for every tile of the given shape, timing the sweep if asked to */
+template <typename F>
+void sweep_tiles(const char *kernel, const cGH *cctkGH, bool columns, bool timed,
+                 const tile_shape &shape, F &&body) {
+  const CCTK_INT imin = cctkGH->cctk_nghostzones[0];
+  const CCTK_INT jmin = cctkGH->cctk_nghostzones[1];
+  const CCTK_INT kmin = cctkGH->cctk_nghostzones[2];
+
+  const CCTK_INT imax = cctkGH->cctk_lsh[0] - cctkGH->cctk_nghostzones[0];
+  const CCTK_INT jmax = cctkGH->cctk_lsh[1] - cctkGH->cctk_nghostzones[1];
+  const CCTK_INT kmax = cctkGH->cctk_lsh[2] - cctkGH->cctk_nghostzones[2];
+
+  const CCTK_INT nj = std::min(shape.nj, jmax - jmin);
+  const CCTK_INT nk = std::min(shape.nk, kmax - kmin);
+
+  const CCTK_INT ntiles_j = (jmax - jmin + nj - 1) / nj;
+  const CCTK_INT ntiles_k = (kmax - kmin + nk - 1) / nk;
+
+  const auto start = std::chrono::steady_clock::now();
+
+#pragma omp parallel for collapse(2) schedule(dynamic)
+  for (CCTK_INT tk = 0; tk < ntiles_k; tk++) {
+    for (CCTK_INT tj = 0; tj < ntiles_j; tj++) {
+      body(tile{imin, imax, jmin + tj * nj, std::min(jmin + (tj + 1) * nj, jmax), kmin + tk * nk,
+                std::min(kmin + (tk + 1) * nk, kmax)});
+    }
+  }
+
+  if (timed) {
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    report_tile_time(kernel, cctkGH, columns, elapsed.count());
+  }
+}
+
+/**************************************************
+ * Calls body(const tile &) for every tile of the *
+ * interior of the component (ghost zones         *
+ * excluded). Tiles are distributed dynamically   *
+ * over the threads. A zero tile size in either   *
+ * direction selects the autotuned shape.         *
+ **************************************************/
+template <typename F>
+void tiled_blocks(const char *kernel, const cGH *cctkGH, CCTK_INT tile_nj, CCTK_INT tile_nk,
+                  F &&body) {
+  for (int d = 0; d < 3; d++) {
+    if (cctkGH->cctk_lsh[d] <= 2 * cctkGH->cctk_nghostzones[d])
+      return;
+  }
+
+  bool timed = false;
+  const tile_shape shape = (tile_nj > 0 && tile_nk > 0)
+                               ? tile_shape{tile_nj, tile_nk}
+                               : next_tile_shape(kernel, cctkGH, false, timed);
+
+  sweep_tiles(kernel, cctkGH, false, timed, shape, body);
+}
+
+/**************************************************
+ * Version of tiled_blocks for kernels that carry *
+ * state from one k plane to the next, so that it *
+ * is set up once per column of tiles. The tiles  *
+ * span the whole k extent, which is only split   *
+ * when there are fewer columns than threads. A   *
+ * zero tile_nj selects the autotuned width.      *
+ **************************************************/
+template <typename F>
+void tiled_columns(const char *kernel, const cGH *cctkGH, CCTK_INT tile_nj, F &&body) {
+  for (int d = 0; d < 3; d++) {
+    if (cctkGH->cctk_lsh[d] <= 2 * cctkGH->cctk_nghostzones[d])
+      return;
+  }
+
+  bool timed = false;
+  tile_shape shape =
+      tile_nj > 0 ? tile_shape{tile_nj, 0} : next_tile_shape(kernel, cctkGH, true, timed);
+
+  const CCTK_INT nj = cctkGH->cctk_lsh[1] - 2 * cctkGH->cctk_nghostzones[1];
+  const CCTK_INT nk = cctkGH->cctk_lsh[2] - 2 * cctkGH->cctk_nghostzones[2];
+  const CCTK_INT ncolumns = (nj + std::min(shape.nj, nj) - 1) / std::min(shape.nj, nj);
+
+#ifdef _OPENMP
+  const CCTK_INT nthreads = omp_get_max_threads();
+#else
+  const CCTK_INT nthreads = 1;
+#endif
+
+  const CCTK_INT nsplits = std::min(nk, (nthreads + ncolumns - 1) / ncolumns);
+  shape.nk = (nk + nsplits - 1) / nsplits;
+
+  sweep_tiles(kernel, cctkGH, true, timed, shape, body);
+}
+
+/* Row by row version of tiled_blocks, calling body(imin, imax, j, k) */
+template <typename F>
+void tiled_rows(const char *kernel, const cGH *cctkGH, CCTK_INT tile_nj, CCTK_INT tile_nk,
+                F &&body) {
+  tiled_blocks(kernel, cctkGH, tile_nj, tile_nk, [&](const tile &t) {
+    for (CCTK_INT k = t.kmin; k < t.kmax; k++)
+      for (CCTK_INT j = t.jmin; j < t.jmax; j++)
+        body(t.imin, t.imax, j, k);
+  });
+}
+
+/* Point by point version of tiled_rows, calling body(i, j, k) */
+template <typename F>
+void tiled_loop(const char *kernel, const cGH *cctkGH, CCTK_INT tile_nj, CCTK_INT tile_nk,
+                F &&body) {
+  tiled_rows(kernel, cctkGH, tile_nj, tile_nk,
+             [&](CCTK_INT imin, CCTK_INT imax, CCTK_INT j, CCTK_INT k) {
+               for (CCTK_INT i = imin; i < imax; i++)
+                 body(i, j, k);
+             });
+}
+
+} // namespace kg
+
+#endif /* TILING_HPP */
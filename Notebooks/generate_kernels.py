@@ -0,0 +1,761 @@
+#!/usr/bin/env python3
+#
+#  FieldPerturbations - Thorns for field evolutions in arbitrary space-times
+#  Copyright (C) 2021  Lucas Timotheo Sanches
+#
+#  This program is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+# generate_kernels.py
+# Generates the point-wise tensor algebra of the KleinGordon and FCKleinGordon
+# thorns from a symbolic description of the equations. Common subexpressions
+# are eliminated across all outputs of a function, so that e.g. the Lagrangian
+# entering the ten components of Tmunu is computed once.
+#
+# The generated functions take derivatives that were already computed by the
+# finite difference stencils, so a single version serves every fd_order.
+#
+# Usage, from the root of the arrangement:
+#
+#   python3 Notebooks/generate_kernels.py
+#
+# This rewrites KleinGordon/src/Generated.hpp, KleinGordon/src/Christoffel.hpp and
+# FCKleinGordon/src/generated.hpp.
+# Requires sympy.
+
+import os
+import re
+
+import sympy as sp
+from sympy.codegen.ast import real
+from sympy.printing.cxx import CXX11CodePrinter
+from sympy.printing.precedence import precedence
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+COLUMNS = 100
+
+
+################################
+#  Symbolic building blocks    #
+################################
+
+XYZ = "xyz"
+ABC = "abc"
+
+
+def symbols(names):
+    return [sp.Symbol(n, real=True) for n in names.split()]
+
+
+def vector(fmt, labels=XYZ):
+    return sp.Matrix([sp.Symbol(fmt.format(l), real=True) for l in labels])
+
+
+def symmetric(fmt, labels=XYZ):
+    def s(i, j):
+        i, j = min(i, j), max(i, j)
+        return sp.Symbol(fmt.format(labels[i] + labels[j]), real=True)
+
+    return sp.Matrix(3, 3, lambda i, j: s(i, j))
+
+
+def dot(u, v):
+    return (u.T * v)[0, 0]
+
+
+def contract(A, B):
+    """A^{ij} B_{ij}"""
+    return sum(A[i, j] * B[i, j] for i in range(3) for j in range(3))
+
+
+################################
+#  C++ printing                #
+################################
+
+
+class Printer(CXX11CodePrinter):
+    """Prints small integer powers as products and square roots with std::sqrt"""
+
+    def _print_Pow(self, expr):
+        base = self.parenthesize(expr.base, precedence(expr))
+        e = expr.exp
+
+        if e == 2:
+            return f"{base} * {base}"
+        if e == -1:
+            return f"1.0 / {base}"
+        if e == -2:
+            return f"1.0 / ({base} * {base})"
+        if e == sp.Rational(1, 2):
+            return f"std::sqrt({self._print(expr.base)})"
+        if e == -sp.Rational(1, 2):
+            return f"1.0 / std::sqrt({self._print(expr.base)})"
+
+        return super()._print_Pow(expr)
+
+    def _print_Rational(self, expr):
+        if expr.q in (2, 4, 8):
+            return repr(float(expr))
+        return f"{expr.p}.0 / {expr.q}.0"
+
+
+PRINTER = Printer({"type_aliases": {real: sp.Symbol("CCTK_REAL")}})
+
+
+def cxx(expr):
+    code = PRINTER.doprint(expr)
+    code = re.sub(r"\s*([*/])\s*", r" \1 ", code)
+    return re.sub(r"\((\d+\.\d+)\)", r"\1", code)
+
+
+def split_top_level(code, operators):
+    """Splits an expression at the binary operators outside of parentheses"""
+    pieces, depth, start = [], 0, 0
+
+    for n, c in enumerate(code):
+        if c == "(":
+            depth += 1
+        elif c == ")":
+            depth -= 1
+        elif (depth == 0 and 0 < n < len(code) - 1 and c in operators and code[n - 1] == " "
+              and code[n + 1] == " "):
+            pieces.append(code[start : n - 1])
+            start = n
+
+    pieces.append(code[start:])
+    return pieces
+
+
+def layout(code, col, cont, width):
+    """
+    Breaks an expression whose first character sits at column col into lines no
+    longer than width, first at the additive operators, then at the
+    multiplicative ones and finally inside parentheses. Lines after the first
+    start at column cont.
+    """
+    if col + len(code) <= width:
+        return [code]
+
+    for operators in ("+-", "*/"):
+        pieces = split_top_level(code, operators)
+        if len(pieces) == 1:
+            continue
+
+        lines, open_line = [], False
+        for piece in pieces:
+            if open_line and len(lines[-1]) + 1 + len(piece) <= width - (col if len(lines) == 1 else 0):
+                lines[-1] += " " + piece
+                continue
+
+            start = col if not lines else cont
+            sub = layout(piece, start, start + 2, width)
+            lines.append(sub[0] if not lines else " " * cont + sub[0])
+            lines += sub[1:]
+            open_line = len(sub) == 1
+
+        return lines
+
+    open_paren = code.find("(")
+    if open_paren >= 0 and code.endswith(")"):
+        inner_col = col + open_paren + 1
+        inner = layout(code[open_paren + 1 : -1], inner_col, inner_col, width)
+        inner[0] = code[: open_paren + 1] + inner[0]
+        inner[-1] += ")"
+        return inner
+
+    return [code]
+
+
+def statement(lhs, rhs, indent):
+    """Assignment wrapped at COLUMNS in the layout clang-format gives the hand-written kernels"""
+    line = f"{indent}{lhs} = {rhs};"
+    if len(line) <= COLUMNS:
+        return [line]
+
+    lines = layout(rhs, len(indent) + 6, len(indent) + 6, COLUMNS - 1)
+    lines[0] = f"{indent}    = {lines[0]}"
+    lines[-1] += ";"
+    return [f"{indent}{lhs}"] + lines
+
+
+################################
+#  Function emission           #
+################################
+
+
+class Function:
+    """
+    A generated inline function.
+
+    params:  C++ parameter declarations.
+    unpack:  (C++ local name, C++ expression) pairs, binding the symbols used
+             in the equations to the parameters.
+    steps:   (C++ local name, sympy expression) pairs of named intermediate
+             quantities, which later expressions may refer to by name.
+    outputs: (C++ member name, sympy expression) pairs. Scalar functions have a
+             single output named None.
+    returns: C++ return type. With declare set, a struct holding the outputs is
+             generated as well.
+    """
+
+    def __init__(self, doc, returns, name, params, unpack, outputs, steps=(), declare=False):
+        self.doc, self.returns, self.name = doc, returns, name
+        self.params, self.unpack = params, unpack
+        self.outputs, self.steps = outputs, list(steps)
+        self.declare = declare
+
+    def declaration(self):
+        members = ", ".join(member for member, _ in self.outputs)
+        return [f"struct {self.returns} {{", f"  CCTK_REAL {members};", "};", ""]
+
+    def emit(self):
+        named = self.steps + self.outputs
+        temporaries, reduced = sp.cse(
+            [e for _, e in named], symbols=sp.numbered_symbols("t"), optimizations="basic",
+            order="none"
+        )
+
+        used = set().union(*(e.free_symbols for e in reduced))
+        used |= set().union(set(), *(e.free_symbols for _, e in temporaries))
+
+        if len(self.doc) == 1:
+            out = [f"/* {self.doc[0]} */"]
+        else:
+            out = ["/*"] + [f" * {line}" for line in self.doc] + [" */"]
+
+        out += wrap_params(f"inline {self.returns} {self.name}(", self.params)
+
+        body = "  "
+        unpacked, computed, results = [], [], []
+        for local, source in self.unpack:
+            if sp.Symbol(local, real=True) in used:
+                unpacked += statement(f"const CCTK_REAL {local}", source, body)
+
+        # Temporaries and steps depend on each other, so each is emitted as soon
+        # as everything it refers to is available
+        pending = [(str(t), e) for t, e in temporaries]
+        pending += [(name, e) for (name, _), e in zip(self.steps, reduced)]
+        defined = {local for local, _ in self.unpack}
+        defined |= {p.split()[-1] for p in self.params if p.startswith("CCTK_REAL ")}
+
+        while pending:
+            for n, (name, e) in enumerate(pending):
+                if {str(x) for x in e.free_symbols} <= defined:
+                    computed += statement(f"const CCTK_REAL {name}", cxx(e), body)
+                    defined.add(name)
+                    del pending[n]
+                    break
+            else:
+                raise RuntimeError(f"Unresolved dependencies in {self.name}")
+
+        values = reduced[len(self.steps) :]
+        if self.outputs[0][0] is None:
+            code = cxx(values[0])
+            if len(f"{body}return {code};") <= COLUMNS:
+                results.append(f"{body}return {code};")
+            else:
+                results += statement("const CCTK_REAL result", code, body)
+                results.append(f"{body}return result;")
+        else:
+            for (member, _), e in zip(self.outputs, values):
+                results += statement(f"const CCTK_REAL {member}", cxx(e), body)
+            results.append("")
+            results += wrap_params(f"{body}return {{", [m for m, _ in self.outputs], "};")
+
+        sections = [section for section in (unpacked, computed, results) if section]
+        for n, section in enumerate(sections):
+            out += ([""] if n else []) + section
+
+        out.append("}")
+        return out
+
+
+def wrap_params(head, params, close=") {"):
+    """Lays out a parameter list the way clang-format would, aligned after the parenthesis"""
+    lines, current = [], head
+    pad = " " * len(head)
+
+    for n, item in enumerate(params):
+        sep = ", " if n + 1 < len(params) else close
+        if len(current + item + sep.rstrip()) > COLUMNS and current != head:
+            lines.append(current.rstrip())
+            current = pad
+        current += item + sep
+
+    lines.append(current)
+    return lines
+
+
+def header(guard, preamble, includes, namespace, functions):
+    out = preamble + ["", f"#ifndef {guard}", f"#define {guard}", ""]
+    out += includes
+    out += ["", f"namespace {namespace} {{", ""]
+
+    for f in functions:
+        if f.declare:
+            out += f.declaration()
+        out += f.emit()
+        out.append("")
+
+    out += [f"}} // namespace {namespace}", "", f"#endif /* {guard} */", ""]
+    return "\n".join(out)
+
+
+################################
+#  Stress energy tensor        #
+################################
+
+
+def stress_energy(alp, beta, d_Phi, d_t_Phi_expr, Phi, m):
+    """
+    Steps and independent components of T_ab = d_a Phi d_b Phi + g_ab L / 2, with
+    L = -m^2 Phi^2 - g^{ab} d_a Phi d_b Phi, the tensor of the equations evolved by both
+    thorns, g^{ab} d_a d_b Phi = m^2 Phi. In Minkowski space T_tt is then
+    (d_t Phi^2 + |grad Phi|^2 + m^2 Phi^2) / 2. The spatial metric and its inverse are
+    read from h{}L and ih{}L, the latter computed by tensor::inverse in the kernels.
+    """
+    h = symmetric("h{}L")
+    ih = symmetric("ih{}L")
+    beta_low = vector("ibeta{}L")
+    gtt, d_t_Phi, L = symbols("gttL d_t_Phi L")
+
+    g4 = sp.zeros(4, 4)
+    g4[0, 0] = gtt
+    # g_ti is the covariant shift beta_i = g_ij beta^j
+    for i in range(3):
+        g4[0, i + 1] = g4[i + 1, 0] = beta_low[i]
+        for j in range(3):
+            g4[i + 1, j + 1] = h[i, j]
+
+    ig4 = sp.zeros(4, 4)
+    ig4[0, 0] = -1 / alp**2
+    for i in range(3):
+        ig4[0, i + 1] = ig4[i + 1, 0] = beta[i] / alp**2
+        for j in range(3):
+            ig4[i + 1, j + 1] = ih[i, j] - beta[i] * beta[j] / alp**2
+
+    d4_Phi = sp.Matrix([d_t_Phi, *d_Phi])
+
+    steps = (
+        [(f"ibeta{XYZ[i]}L", (h * beta)[i]) for i in range(3)]
+        + [("gttL", -alp**2 + dot(beta_low, beta))]
+        + [("d_t_Phi", d_t_Phi_expr)]
+        + [("L", -((m * Phi) ** 2) - (d4_Phi.T * ig4 * d4_Phi)[0, 0])]
+    )
+
+    def T(a, b):
+        return d4_Phi[a] * d4_Phi[b] + g4[a, b] * L / 2
+
+    labels = "txyz"
+    return steps, [(labels[a] + labels[b], T(a, b)) for a in range(4) for b in range(a, 4)]
+
+
+################################
+#  KleinGordon                 #
+################################
+
+
+def kg_functions():
+    alp, Phi, K_Phi, m = symbols("alpL PhiL K_PhiL field_mass")
+    beta = vector("beta{}L")
+    d_Phi = vector("d_{}_Phi")
+
+    stress_steps, components = stress_energy(
+        alp, beta, d_Phi, dot(beta, d_Phi) - 2 * alp * K_Phi, Phi, m
+    )
+
+    stress_params = [
+        "CCTK_REAL alpL",
+        "CCTK_REAL betaxL",
+        "CCTK_REAL betayL",
+        "CCTK_REAL betazL",
+        "const symmetric3 &h",
+        "const symmetric3 &ih",
+        "CCTK_REAL PhiL",
+        "CCTK_REAL K_PhiL",
+        "const global_gradient &d_Phi",
+        "CCTK_REAL field_mass",
+    ]
+    components3 = ("xx", "xy", "xz", "yy", "yz", "zz")
+    stress_unpack = (
+        [(f"h{c}L", f"h.{c}") for c in components3]
+        + [(f"ih{c}L", f"ih.{c}") for c in components3]
+        + [(f"d_{c}_Phi", f"d_Phi.d{c}") for c in XYZ]
+    )
+
+    stress = Function(
+        ["Energy momentum tensor of the field, T_ab = d_a Phi d_b Phi + g_ab L / 2,",
+         "with L = -m^2 Phi^2 - g^{ab} d_a Phi d_b Phi."],
+        "stress_energy_tensor",
+        "compute_stress_energy",
+        stress_params,
+        stress_unpack,
+        components,
+        steps=stress_steps,
+        declare=True,
+    )
+
+    energy = Function(
+        ["Energy density of the field, T_tt"],
+        "CCTK_REAL",
+        "compute_energy_density",
+        stress_params,
+        stress_unpack,
+        [(None, components[0][1])],
+        steps=stress_steps,
+    )
+
+    # K_Phi right hand side, Eq. (A3d) of arXiv:1709.06118
+    ig = symmetric("ig{}")
+    K_trace = sp.Symbol("K_trace", real=True)
+    Gamma = vector("Gamma_{}")
+    d_alp = vector("d_{}_alp")
+    dd_Phi = symmetric("d_{}_Phi")
+    d_K_Phi = vector("d_{}_K_Phi")
+
+    K_Phi_rhs = (
+        alp * (K_trace * K_Phi - (contract(ig, dd_Phi) - dot(Gamma, d_Phi)) / 2 + m**2 * Phi / 2)
+        - dot(d_alp, ig * d_Phi) / 2
+        + dot(beta, d_K_Phi)
+    )
+
+    rhs = Function(
+        ["K_Phi right hand side at one point, Eq. (A3d) of arXiv:1709.06118"],
+        "CCTK_REAL",
+        "K_Phi_rhs_point",
+        [
+            "const background &b",
+            "CCTK_REAL alpL",
+            "CCTK_REAL betaxL",
+            "CCTK_REAL betayL",
+            "CCTK_REAL betazL",
+            "CCTK_REAL PhiL",
+            "CCTK_REAL K_PhiL",
+            "const global_gradient &d_Phi",
+            "const global_hessian &dd_Phi",
+            "const global_gradient &d_K_Phi",
+            "CCTK_REAL field_mass",
+        ],
+        [(f"ig{c}", f"b.ig.{c}") for c in ("xx", "xy", "xz", "yy", "yz", "zz")]
+        + [("K_trace", "b.K_trace")]
+        + [(f"Gamma_{c}", f"b.Gamma.d{c}") for c in XYZ]
+        + [(f"d_{c}_alp", f"b.d_alp.d{c}") for c in XYZ]
+        + [(f"d_{c}_Phi", f"d_Phi.d{c}") for c in XYZ]
+        + [(f"d_{c}_Phi", f"dd_Phi.d{c}") for c in ("xx", "xy", "xz", "yy", "yz", "zz")]
+        + [(f"d_{c}_K_Phi", f"d_K_Phi.d{c}") for c in XYZ],
+        [(None, K_Phi_rhs)],
+    )
+
+    # Patch-local wave operator, see local_operator in Background.hpp
+    J = sp.Matrix(3, 3, lambda a, i: sp.Symbol(f"J{a + 1}{i + 1}", real=True))
+    dJ = [
+        sp.Matrix(3, 3, lambda i, j: sp.Symbol(f"dJ{a + 1}{min(i, j) + 1}{max(i, j) + 1}", real=True))
+        for a in range(3)
+    ]
+
+    G = alp * J * ig * J.T
+    e = J * Gamma - sp.Matrix([contract(ig, dJ[a]) for a in range(3)])
+    u = (alp * e - J * ig * d_alp) / 2
+    beta_local = J * beta
+
+    local = Function(
+        ["Wave operator of a static background in patch local coordinates"],
+        "local_operator",
+        "to_local",
+        [
+            "const background &b",
+            "CCTK_REAL alpL",
+            "const global_gradient &beta",
+            "const jacobian &J",
+            "const jacobian_derivatives &dJ",
+        ],
+        [(f"ig{c}", f"b.ig.{c}") for c in ("xx", "xy", "xz", "yy", "yz", "zz")]
+        + [("K_trace", "b.K_trace")]
+        + [(f"Gamma_{c}", f"b.Gamma.d{c}") for c in XYZ]
+        + [(f"d_{c}_alp", f"b.d_alp.d{c}") for c in XYZ]
+        + [(f"beta{c}L", f"beta.d{c}") for c in XYZ]
+        + [(f"J{a}{i}", f"J.J{a}{i}") for a in (1, 2, 3) for i in (1, 2, 3)]
+        + [(f"dJ{a}{ij}", f"dJ.J{a}{ij}") for a in (1, 2, 3)
+           for ij in ("11", "12", "13", "22", "23", "33")],
+        [(f"G_{ABC[a]}{ABC[b]}", G[a, b]) for a in range(3) for b in range(a, 3)]
+        + [(f"u_{ABC[a]}", u[a]) for a in range(3)]
+        + [(f"beta_{ABC[a]}", beta_local[a]) for a in range(3)]
+        + [("alp_K", alp * K_trace)],
+    )
+
+    lG = symmetric("G_{}", ABC)
+    lu = vector("u_{}", ABC)
+    lbeta = vector("beta_{}", ABC)
+    alp_K = sp.Symbol("alp_K", real=True)
+    l_d_Phi = vector("d_{}_Phi", ABC)
+    l_dd_Phi = symmetric("d_{}_Phi", ABC)
+    l_d_K_Phi = vector("d_{}_K_Phi", ABC)
+
+    local_rhs = Function(
+        ["K_Phi right hand side at one point, from the patch-local operator"],
+        "CCTK_REAL",
+        "K_Phi_rhs_local",
+        [
+            "const local_operator &op",
+            "CCTK_REAL alpL",
+            "CCTK_REAL PhiL",
+            "CCTK_REAL K_PhiL",
+            "const local_derivatives &l_Phi",
+            "const local_gradient &l_K_Phi",
+            "CCTK_REAL field_mass",
+        ],
+        [(f"G_{c}", f"op.G.{c}") for c in ("aa", "ab", "ac", "bb", "bc", "cc")]
+        + [(f"u_{c}", f"op.u.{c}") for c in ABC]
+        + [(f"beta_{c}", f"op.beta.{c}") for c in ABC]
+        + [("alp_K", "op.alp_K")]
+        + [(f"d_{c}_Phi", f"l_Phi.d.d{c}") for c in ABC]
+        + [(f"d_{c}_Phi", f"l_Phi.d{c}") for c in ("aa", "ab", "ac", "bb", "bc", "cc")]
+        + [(f"d_{c}_K_Phi", f"l_K_Phi.d{c}") for c in ABC],
+        [(None, alp_K * K_Phi - contract(lG, l_dd_Phi) / 2 + dot(lu, l_d_Phi)
+          + alp * m**2 * Phi / 2 + dot(lbeta, l_d_K_Phi))],
+    )
+
+    return [stress, energy, rhs, local, local_rhs]
+
+
+def christoffel_functions():
+    ig = symmetric("ig{}L")
+    d_g = [
+        [sp.Symbol(f"d_{XYZ[l]}_g{XYZ[min(i, j)]}{XYZ[max(i, j)]}", real=True) for l in range(3)]
+        for i in range(3)
+        for j in range(3)
+    ]
+
+    def dg(l, i, j):
+        """d_l g_{ij}"""
+        return d_g[3 * i + j][l]
+
+    # Gamma^i_{jk} = g^{il} (d_j g_{lk} + d_k g_{lj} - d_l g_{jk}) / 2, one step per symbol
+    pairs = [(j, k) for j in range(3) for k in range(j, 3)]
+    steps = [
+        (
+            f"Gamma_{XYZ[i]}{XYZ[j]}{XYZ[k]}",
+            sum(ig[i, l] * (dg(j, l, k) + dg(k, l, j) - dg(l, j, k)) for l in range(3)) / 2,
+        )
+        for i in range(3)
+        for j, k in pairs
+    ]
+
+    def Gamma(i, j, k):
+        j, k = min(j, k), max(j, k)
+        return sp.Symbol(f"Gamma_{XYZ[i]}{XYZ[j]}{XYZ[k]}", real=True)
+
+    contracted = [
+        (f"d{XYZ[i]}", sum(ig[j, k] * Gamma(i, j, k) for j in range(3) for k in range(3)))
+        for i in range(3)
+    ]
+
+    components3 = ("xx", "xy", "xz", "yy", "yz", "zz")
+
+    gamma = Function(
+        ["Contracted Christoffel symbols Gamma^i = g^{jk} Gamma^i_{jk}, with all 18",
+         "Gamma^i_{jk} formed first."],
+        "global_gradient",
+        "contracted_christoffel",
+        [f"CCTK_REAL ig{c}L" for c in components3]
+        + [f"const global_gradient &d_g{c}" for c in components3],
+        [(f"d_{l}_g{c}", f"d_g{c}.d{l}") for c in components3 for l in XYZ],
+        contracted,
+        steps=steps,
+    )
+
+    return [gamma]
+
+
+################################
+#  FCKleinGordon               #
+################################
+
+
+def fckg_functions():
+    alp, sqrtg, Pi, Phi, m = symbols("alpL sqrtg PiL PhiL field_mass")
+    beta = vector("beta{}L")
+    Psi = vector("Psi_{}L")
+    ig = symmetric("ig{}")
+
+    # F^i_Pi = alp sqrt(g) g^{ij} Psi_j - beta^i Pi, F_Psi = alp Pi / sqrt(g) - beta^i Psi_i
+    F_Pi = alp * sqrtg * ig * Psi - beta * Pi
+    F_Psi = alp * Pi / sqrtg - dot(beta, Psi)
+
+    params = [
+        "const metric_inverse &m",
+        "CCTK_REAL alpL",
+        "CCTK_REAL betaxL",
+        "CCTK_REAL betayL",
+        "CCTK_REAL betazL",
+        "CCTK_REAL PiL",
+        "CCTK_REAL Psi_xL",
+        "CCTK_REAL Psi_yL",
+        "CCTK_REAL Psi_zL",
+    ]
+    unpack = [(f"ig{c}", f"m.ig.{c}") for c in ("xx", "xy", "xz", "yy", "yz", "zz")] + [
+        ("sqrtg", "m.sqrtg")
+    ]
+
+    flux = Function(
+        ["Fluxes of the first order system"],
+        "fluxes",
+        "compute_fluxes",
+        params,
+        unpack,
+        [("F_Pi_x", F_Pi[0]), ("F_Pi_y", F_Pi[1]), ("F_Pi_z", F_Pi[2]), ("F_Psi", F_Psi)],
+        declare=True,
+    )
+
+    sources = Function(
+        ["Sources of the first order system"],
+        "source_terms",
+        "compute_sources",
+        ["CCTK_REAL sqrtg"] + params[1:] + ["CCTK_REAL PhiL", "CCTK_REAL field_mass"],
+        [],
+        [("S_Pi", alp * sqrtg * m**2 * Phi), ("S_Phi", dot(beta, Psi) - alp * Pi / sqrtg)],
+        declare=True,
+    )
+
+    # Stress energy tensor with d_t Phi = beta^i Psi_i - alp Pi / sqrt(g) from the Phi
+    # equation, so that no derivative stencils are needed
+    stress_steps, components = stress_energy(
+        alp, beta, Psi, dot(beta, Psi) - alp * Pi / sqrtg, Phi, m
+    )
+
+    components3 = ("xx", "xy", "xz", "yy", "yz", "zz")
+    stress_params = (
+        ["const tensor::sym3<CCTK_REAL> &h"]
+        + params
+        + ["CCTK_REAL PhiL", "CCTK_REAL field_mass"]
+    )
+    stress_unpack = (
+        [(f"h{c}L", f"h.{c}") for c in components3]
+        + [(f"ih{c}L", f"m.ig.{c}") for c in components3]
+        + [("sqrtg", "m.sqrtg")]
+    )
+
+    stress = Function(
+        ["Energy momentum tensor of the field, T_ab = d_a Phi d_b Phi + g_ab L / 2,",
+         "with L = -m^2 Phi^2 - g^{ab} d_a Phi d_b Phi."],
+        "stress_energy_tensor",
+        "compute_stress_energy",
+        stress_params,
+        stress_unpack,
+        components,
+        steps=stress_steps,
+        declare=True,
+    )
+
+    energy = Function(
+        ["Energy density of the field, T_tt"],
+        "CCTK_REAL",
+        "compute_energy_density",
+        stress_params,
+        stress_unpack,
+        [(None, components[0][1])],
+        steps=stress_steps,
+    )
+
+    return [flux, sources, stress, energy]
+
+
+################################
+#  Output                      #
+################################
+
+KG_PREAMBLE = """/*
+ *  KleinGordon - Thorn for scalar wave evolutions in arbitrary space-times
+ *  Copyright (C) 2021  Lucas Timotheo Sanches
+ *
+ *  This file is part of KleinGordon.
+ *
+ *  KleinGordon is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  KleinGordon is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Foobar.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  {name}
+{description}
+ *
+ *  Generated by Notebooks/generate_kernels.py. Do not edit by hand.
+ */"""
+
+
+def kg_preamble(name, description):
+    text = KG_PREAMBLE.format(name=name, description="\n".join(f" *  {l}" for l in description))
+    return text.split("\n")
+
+
+FCKG_PREAMBLE = [
+    "/*",
+    " * Fluxes and sources of the first order system, the energy momentum tensor and the",
+    " * energy density.",
+    " *",
+    " * Generated by Notebooks/generate_kernels.py. Do not edit by hand.",
+    " */",
+]
+
+
+def main():
+    targets = [
+        (
+            "KleinGordon/src/Generated.hpp",
+            "GENERATED_HPP",
+            kg_preamble(
+                "Generated.hpp",
+                ["Point-wise tensor algebra of the evolution equations, the energy",
+                 "momentum tensor and the energy density."],
+            ),
+            ['#include "Background.hpp"', '#include "Derivatives.hpp"'],
+            "kg",
+            kg_functions(),
+        ),
+        (
+            "KleinGordon/src/Christoffel.hpp",
+            "CHRISTOFFEL_HPP",
+            kg_preamble(
+                "Christoffel.hpp",
+                ["Contracted Christoffel symbols of the christoffel formulation of",
+                 "the background, see compute_background in Background.hpp."],
+            ),
+            ['#include "Derivatives.hpp"'],
+            "kg",
+            christoffel_functions(),
+        ),
+        (
+            "FCKleinGordon/src/generated.hpp",
+            "FC_KLEIN_GORDON_GENERATED_HPP",
+            FCKG_PREAMBLE,
+            ['#include "background.hpp"', "", "#include <cctk.h>", "#include <cmath>"],
+            "fckg",
+            fckg_functions(),
+        ),
+    ]
+
+    for path, guard, preamble, includes, namespace, functions in targets:
+        with open(os.path.join(ROOT, path), "w") as f:
+            f.write(header(guard, preamble, includes, namespace, functions))
+        print(f"Wrote {path}")
+
+
+if __name__ == "__main__":
+    main()